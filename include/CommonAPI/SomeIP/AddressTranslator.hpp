@@ -46,8 +46,6 @@ private:
     COMMONAPI_EXPORT bool isValidInstance(const instance_id_t) const;
 
 private:
-    std::string defaultConfig_;
-
     std::map<CommonAPI::Address, Address> forwards_;
     std::map<Address, CommonAPI::Address> backwards_;
 
@@ -0,0 +1,82 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_ADMISSION_CONTROL_HPP_
+#define COMMONAPI_SOMEIP_ADMISSION_CONTROL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <CommonAPI/Export.hpp>
+#include <CommonAPI/SomeIP/Configuration.hpp>
+#include <CommonAPI/SomeIP/PackedKeyTable.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class AdmissionControl
+ *
+ * Applies the configured admission limits to incoming requests. A request
+ * is admitted to the queue of its connection by #enqueue, and moves from
+ * the queue to dispatching by #start, which is ended by #finish. If either
+ * step would exceed a limit of the service or the method, the request must
+ * be rejected instead and is counted as shed.
+ *
+ * The limits are fixed when the object is created, so the counters are
+ * found without locking. Requests of services without limits are neither
+ * counted nor shed.
+ */
+class AdmissionControl {
+public:
+    COMMONAPI_EXPORT AdmissionControl(const Configuration::service_limits_t &_serviceLimits,
+                                      const Configuration::method_limits_t &_methodLimits);
+
+    AdmissionControl(const AdmissionControl &) = delete;
+    AdmissionControl &operator=(const AdmissionControl &) = delete;
+
+    COMMONAPI_EXPORT bool enqueue(service_id_t _service, method_id_t _method);
+    COMMONAPI_EXPORT bool start(service_id_t _service, method_id_t _method);
+    COMMONAPI_EXPORT void finish(service_id_t _service, method_id_t _method);
+
+    // Number of shed requests of a service or a method
+    COMMONAPI_EXPORT uint64_t getShedCount(service_id_t _service) const;
+    COMMONAPI_EXPORT uint64_t getShedCount(service_id_t _service, method_id_t _method) const;
+
+private:
+    struct Counter {
+        Counter(const AdmissionLimits &_limits)
+            : limits_(_limits), queued_(0), inFlight_(0), shed_(0) {
+        }
+
+        const AdmissionLimits limits_;
+        std::atomic<std::size_t> queued_;
+        std::atomic<std::size_t> inFlight_;
+        std::atomic<uint64_t> shed_;
+    };
+
+    static bool acquire(std::atomic<std::size_t> &_count, std::size_t _limit);
+    static void shed(Counter *_service, Counter *_method);
+
+    Counter *findService(service_id_t _service) const;
+    Counter *findMethod(service_id_t _service, method_id_t _method) const;
+
+    std::vector<std::unique_ptr<Counter>> counters_;
+    PackedKeyTable<Counter *> services_;
+    PackedKeyTable<Counter *> methods_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_ADMISSION_CONTROL_HPP_
@@ -0,0 +1,72 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_BYTE_BUFFER_VIEW_HPP_
+#define COMMONAPI_SOMEIP_BYTE_BUFFER_VIEW_HPP_
+
+#include <cstddef>
+
+#include <CommonAPI/Types.hpp>
+
+#include <CommonAPI/SomeIP/Message.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class ByteBufferView
+ *
+ * Argument type that can be used instead of a ByteBuffer. It is serialized
+ * exactly like a ByteBuffer, but does not own its data:
+ * - On receive, the view points into the body of the received #Message and
+ *   keeps the message alive as long as the view (or a copy of it) exists.
+ *   Large opaque data can therefore be handed to stubs and event listeners
+ *   without being copied.
+ * - On send, the view points to memory owned by the caller, which must stay
+ *   valid until the value has been serialized.
+ */
+class ByteBufferView {
+public:
+    ByteBufferView()
+        : data_(nullptr), size_(0) {
+    }
+
+    ByteBufferView(const byte_t *_data, size_t _size)
+        : data_(_data), size_(_size) {
+    }
+
+    explicit ByteBufferView(const ByteBuffer &_buffer)
+        : data_(_buffer.data()), size_(_buffer.size()) {
+    }
+
+    ByteBufferView(const Message &_message, const byte_t *_data, size_t _size)
+        : message_(_message), data_(_data), size_(_size) {
+    }
+
+    const byte_t *data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return (size_ == 0); }
+
+    const byte_t *begin() const { return data_; }
+    const byte_t *end() const { return data_ + size_; }
+
+    ByteBuffer toByteBuffer() const {
+        return ByteBuffer(begin(), end());
+    }
+
+private:
+    Message message_;
+    const byte_t *data_;
+    size_t size_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_BYTE_BUFFER_VIEW_HPP_
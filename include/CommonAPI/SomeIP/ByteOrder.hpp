@@ -0,0 +1,47 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_BYTE_ORDER_HPP_
+#define COMMONAPI_SOMEIP_BYTE_ORDER_HPP_
+
+#include <cstddef>
+#include <type_traits>
+
+#include <CommonAPI/Export.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * Marks the types whose arrays can be (de-)serialized as one block: the wire
+ * representation of such an array is the sequence of its elements in network
+ * byte order without any padding or per element length fields.
+ */
+template<typename Type_>
+struct is_bulk_serializable
+    : std::integral_constant<bool,
+        std::is_arithmetic<Type_>::value && !std::is_same<Type_, bool>::value> {
+};
+
+/**
+ * Copies _count values of _width bytes each from _source to _target and
+ * converts them from host to network byte order (or vice versa, as the
+ * conversion is symmetric). Source and target must not overlap.
+ *
+ * On x86 the conversion uses SSSE3/AVX2 byte shuffles if the CPU supports
+ * them, otherwise (and on all other platforms) a scalar loop is used.
+ */
+COMMONAPI_EXPORT void copyByteOrdered(byte_t *_target, const byte_t *_source,
+                                      size_t _count, size_t _width);
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_BYTE_ORDER_HPP_
@@ -0,0 +1,62 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_CLIENT_ID_TABLE_HPP_
+#define COMMONAPI_SOMEIP_CLIENT_ID_TABLE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <CommonAPI/Export.hpp>
+#include <CommonAPI/SomeIP/ClientId.hpp>
+#include <CommonAPI/SomeIP/PackedKeyTable.hpp>
+#include <CommonAPI/SomeIP/ReadCopyUpdate.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class ClientIdTable
+ *
+ * Hands out the same ClientId object for all requests of a client instead
+ * of creating one per request. Known clients are found without locking.
+ *
+ * Objects that are not referenced outside the table anymore are removed
+ * when the table has grown, so the table does not keep the identifiers of
+ * all clients that ever sent a request.
+ */
+class ClientIdTable {
+public:
+    COMMONAPI_EXPORT ClientIdTable();
+
+    ClientIdTable(const ClientIdTable &) = delete;
+    ClientIdTable &operator=(const ClientIdTable &) = delete;
+
+    COMMONAPI_EXPORT std::shared_ptr<ClientId> get(client_id_t _client);
+
+private:
+    void prune();
+
+    std::mutex mutex_;
+    std::vector<std::pair<uint64_t, std::shared_ptr<ClientId>>> clientIds_;
+    std::size_t pruneSize_;
+
+    // Read-only copy of clientIds_
+    typedef PackedKeyTable<std::shared_ptr<ClientId>> client_id_table_t;
+    ReadCopyUpdate<client_id_table_t> table_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_CLIENT_ID_TABLE_HPP_
@@ -10,15 +10,116 @@
 #ifndef COMMONAPI_SOMEIP_CONFIGURATION_HPP_
 #define COMMONAPI_SOMEIP_CONFIGURATION_HPP_
 
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <CommonAPI/Export.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
 namespace CommonAPI {
+
+class IniFileReader;
+
 namespace SomeIP {
 
+extern const char *COMMONAPI_SOMEIP_DEFAULT_CONFIG_FILE;
+extern const char *COMMONAPI_SOMEIP_DEFAULT_CONFIG_FOLDER;
+
 struct FactoryConfig {
     bool useVirtualMode;
 };
 
+/**
+ * Determines which requests are dispatched by the same worker thread and
+ * are therefore processed in the order they were received.
+ */
+enum class StubDispatchOrder {
+    SERVICE, // requests to the same service instance
+    CLIENT   // requests from the same client
+};
+
+/**
+ * Limits the number of requests of a service or method that are waiting
+ * to be dispatched (queued) or are being dispatched (in flight). Zero
+ * means unlimited.
+ */
+struct AdmissionLimits {
+    AdmissionLimits() : maxQueued_(0), maxInFlight_(0) {}
+
+    std::size_t maxQueued_;
+    std::size_t maxInFlight_;
+};
+
+/**
+ * @class Configuration
+ *
+ * Runtime settings of the binding. They are read from the sections of the
+ * SOME/IP configuration file that are not address mappings:
+ *
+ * [dispatch]
+ * stub-threads=4
+ * stub-order=service|client
+ * mainloop-budget=16
+ *
+ * [admission]
+ * <service>.max-queued=<n>
+ * <service>.max-in-flight=<n>
+ * <service>.<method>.max-queued=<n>
+ * <service>.<method>.max-in-flight=<n>
+ */
+class Configuration {
+public:
+    COMMONAPI_EXPORT static std::shared_ptr<Configuration> get();
+
+    COMMONAPI_EXPORT Configuration();
+
+    COMMONAPI_EXPORT void init();
+
+    /**
+     * Returns the parsed SOME/IP configuration file or nullptr if it cannot
+     * be loaded. The file is taken from the current working directory if it
+     * exists there. Otherwise, it is given by the environment variable
+     * COMMONAPI_SOMEIP_CONFIG or defaults to the one in /etc. The file is
+     * located and parsed once per process.
+     */
+    COMMONAPI_EXPORT static std::shared_ptr<const IniFileReader> getConfigurationFile();
+
+    /**
+     * Number of worker threads that dispatch stub requests of connections
+     * without main loop. Zero means that requests are dispatched by the
+     * receiving thread. At most four threads per core are accepted.
+     */
+    COMMONAPI_EXPORT std::size_t getStubDispatchThreads() const;
+    COMMONAPI_EXPORT StubDispatchOrder getStubDispatchOrder() const;
+
+    /**
+     * Maximum number of received messages that are handled per dispatch
+     * of a main loop before control is returned to the main loop.
+     */
+    COMMONAPI_EXPORT std::size_t getMainLoopDispatchBudget() const;
+
+    typedef std::map<service_id_t, AdmissionLimits> service_limits_t;
+    typedef std::map<std::pair<service_id_t, method_id_t>, AdmissionLimits> method_limits_t;
+
+    COMMONAPI_EXPORT const service_limits_t &getServiceAdmissionLimits() const;
+    COMMONAPI_EXPORT const method_limits_t &getMethodAdmissionLimits() const;
+
+private:
+    COMMONAPI_EXPORT bool readConfiguration();
+    COMMONAPI_EXPORT void readAdmissionLimits(const std::string &_key, const std::string &_value);
+
+    std::size_t stubDispatchThreads_;
+    StubDispatchOrder stubDispatchOrder_;
+    std::size_t mainLoopDispatchBudget_;
+
+    service_limits_t serviceAdmissionLimits_;
+    method_limits_t methodAdmissionLimits_;
+};
+
 } // namespace SomeIP
 } // namespace CommonAPI
 
 #endif // COMMONAPI_SOMEIP_CONFIGURATION_HPP_
-
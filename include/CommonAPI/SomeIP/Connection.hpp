@@ -16,10 +16,18 @@
 #include <vsomeip/application.hpp>
 
 #include <CommonAPI/MainLoopContext.hpp>
+#include <CommonAPI/SomeIP/AdmissionControl.hpp>
+#include <CommonAPI/SomeIP/ClientIdTable.hpp>
+#include <CommonAPI/SomeIP/Configuration.hpp>
+#include <CommonAPI/SomeIP/PackedKeyTable.hpp>
+#include <CommonAPI/SomeIP/PendingCallTable.hpp>
 #include <CommonAPI/SomeIP/ProxyConnection.hpp>
+#include <CommonAPI/SomeIP/ReadCopyUpdate.hpp>
 #include <CommonAPI/SomeIP/StubManager.hpp>
+#include <CommonAPI/SomeIP/TimerService.hpp>
 #include <CommonAPI/SomeIP/DispatchSource.hpp>
 #include <CommonAPI/SomeIP/Watch.hpp>
+#include <CommonAPI/SomeIP/WorkerPool.hpp>
 
 namespace CommonAPI {
 namespace SomeIP {
@@ -59,6 +67,11 @@ public:
     virtual bool sendEvent(const Message &message, client_id_t _client,
             uint32_t *allocatedSerial = NULL) const;
 
+    virtual bool sendEvent(const Message &message,
+            const std::vector<client_id_t> &_clients) const;
+
+    virtual bool sendEvents(const std::vector<Message> &_messages) const;
+
     void addEventHandler(service_id_t serviceId, instance_id_t instanceId,
             eventgroup_id_t eventGroupId, event_id_t eventId,
             ProxyConnection::EventHandler* eventHandler, major_version_t major);
@@ -101,6 +114,11 @@ public:
     virtual void setStubMessageHandler(MessageHandler_t stubMessageHandler);
     virtual bool isStubMessageHandlerSet();
 
+    virtual std::shared_ptr<ClientId> getClientId(client_id_t _client) const;
+
+    virtual uint64_t getShedRequestCount(service_id_t _service) const;
+    virtual uint64_t getShedRequestCount(service_id_t _service, method_id_t _method) const;
+
     virtual void processMsgQueueEntry(Watch::msgQueueEntry &_msgQueueEntry);
 
     virtual const ConnectionId_t& getConnectionId();
@@ -113,15 +131,18 @@ public:
             uint32_t tag);
 
 private:
-    void proxyReceive(const std::shared_ptr<vsomeip::message> &_message);
-    void handleProxyReceive(const std::shared_ptr<vsomeip::message> &_message);
+    void proxyReceive(const std::shared_ptr<vsomeip::message> &_message) const;
+    void handleProxyReceive(const std::shared_ptr<vsomeip::message> &_message) const;
     void stubReceive(const std::shared_ptr<vsomeip::message> &_message);
     void handleStubReceive(const std::shared_ptr<vsomeip::message> &_message);
+    bool isAdmissionControlled(const std::shared_ptr<vsomeip::message> &_message) const;
+    void rejectRequest(const std::shared_ptr<vsomeip::message> &_message) const;
     void onConnectionEvent(state_type_e _state);
     void onAvailabilityChange(service_id_t _service, instance_id_t _instance,
             bool _is_available);
     void dispatch();
-    void cleanup();
+    void onCallTimeout(session_id_t _session) const;
+    void updateEventHandlerTable();
 
     void eventInitialValueCallback(const CallStatus callStatus,
                 const Message& message, EventHandler *_eventHandler,
@@ -144,25 +165,20 @@ private:
     std::mutex stubManagerGuard_;
     std::function<bool(const Message&)> stubMessageHandler_;
 
+    // Dispatches stub requests if no main loop is attached (optional)
+    std::unique_ptr<WorkerPool> stubWorkers_;
+    StubDispatchOrder stubDispatchOrder_;
+
+    // Sheds stub requests that exceed the configured limits (optional)
+    std::unique_ptr<AdmissionControl> admission_;
+
     std::shared_ptr<vsomeip::application> application_;
 
-    mutable std::mutex sendAndBlockMutex_;
-    mutable std::pair<session_id_t, Message> sendAndBlockAnswer_;
-    mutable std::condition_variable sendAndBlockCondition_;
-    mutable bool sendAndBlockWait_;
+    std::shared_ptr<TimerService> timerService_;
 
-    std::shared_ptr<std::thread> asyncAnswersCleanupThread_;
-    std::mutex cleanupMutex_;
-    mutable std::condition_variable cleanupCondition_;
-    bool cleanupCancelled_;
+    mutable PendingCallTable pendingCalls_;
 
-    mutable std::mutex sendReceiveMutex_;
-    typedef std::map<session_id_t,
-            std::tuple<
-                    std::chrono::time_point<std::chrono::high_resolution_clock>,
-                    std::shared_ptr<vsomeip::message>,
-                    std::unique_ptr<MessageReplyAsyncHandler> > > async_answers_map_t;
-    mutable async_answers_map_t asyncAnswers_;
+    mutable ClientIdTable clientIds_;
 
     mutable std::mutex eventHandlerMutex_;
     typedef std::map<service_id_t,
@@ -171,6 +187,17 @@ private:
                             std::set<ProxyConnection::EventHandler*>>>> events_map_t;
     mutable events_map_t eventHandlers_;
 
+    // Handlers that share their decoding are adjacent, each but the first
+    // of them is marked to share the decoding with its predecessor.
+    struct EventHandlerEntry {
+        ProxyConnection::EventHandler *handler_;
+        bool sharesDecoding_;
+    };
+
+    // Read-only copy of eventHandlers_ used to dispatch notifications
+    typedef PackedKeyTable<std::vector<EventHandlerEntry>> event_handler_table_t;
+    ReadCopyUpdate<event_handler_table_t> eventHandlerTable_;
+
     mutable std::mutex availabilityMutex_;
     typedef std::map<service_id_t,
             std::map<instance_id_t,
@@ -10,26 +10,31 @@
 #ifndef DISPATCHSOURCE_HPP_
 #define DISPATCHSOURCE_HPP_
 
+#include <cstddef>
 #include <memory>
 #include "CommonAPI/MainLoopContext.hpp"
 #include <mutex>
+#include <vector>
+
+#include <CommonAPI/SomeIP/Watch.hpp>
 
 namespace CommonAPI {
 namespace SomeIP {
 
-class Watch;
-
 class DispatchSource: public CommonAPI::DispatchSource {
  public:
-    DispatchSource(const std::shared_ptr<Watch>& watch);
+    DispatchSource(const std::shared_ptr<Watch>& watch, std::size_t _budget);
     virtual ~DispatchSource();
 
     bool prepare(int64_t& timeout);
     bool check();
+    // Handles up to budget_ queued messages per call
     bool dispatch();
 
  private:
     std::shared_ptr<Watch> watch_;
+    const std::size_t budget_;
+    std::vector<Watch::msgQueueEntry> entries_;
 
     std::mutex watchMutex_;
 };
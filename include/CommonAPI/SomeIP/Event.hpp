@@ -10,14 +10,62 @@
 #ifndef COMMONAPI_SOMEIP_EVENT_HPP_
 #define COMMONAPI_SOMEIP_EVENT_HPP_
 
+#include <initializer_list>
+#include <memory>
+#include <tuple>
+
 #include <CommonAPI/Event.hpp>
 #include <CommonAPI/Logger.hpp>
 
 namespace CommonAPI {
 namespace SomeIP {
 
+/**
+ * Events with the same arguments and deployments decode notifications the
+ * same way and therefore share their decoding.
+ */
+template <typename... Arguments_>
+class EventDecoding {
+public:
+    virtual ~EventDecoding() {}
+    virtual const std::tuple<Arguments_...> &getArguments() const = 0;
+};
+
+template <typename Type_>
+inline bool hasSameDeployment(const Type_ &, const Type_ &) {
+    return true;
+}
+
+template <typename Type_, typename Deployment_>
+inline bool hasSameDeployment(const Deployable<Type_, Deployment_> &_first,
+                              const Deployable<Type_, Deployment_> &_second) {
+    return (_first.getDepl() == _second.getDepl());
+}
+
+template <typename Type_>
+inline Type_ copyDeployment(const Type_ &) {
+    return Type_();
+}
+
+template <typename Type_, typename Deployment_>
+inline Deployable<Type_, Deployment_> copyDeployment(const Deployable<Type_, Deployment_> &_value) {
+    return Deployable<Type_, Deployment_>(_value.getDepl());
+}
+
+template <typename Type_>
+inline const Type_ &getArgumentValue(const Type_ &_value) {
+    return _value;
+}
+
+template <typename Type_, typename Deployment_>
+inline const Type_ &getArgumentValue(const Deployable<Type_, Deployment_> &_value) {
+    return _value.getValue();
+}
+
 template <typename Events_, typename... Arguments_>
-class Event: public Events_, public ProxyConnection::EventHandler {
+class Event: public Events_,
+             public ProxyConnection::EventHandler,
+             public EventDecoding<Arguments_...> {
 public:
     typedef typename Events_::ArgumentsTuple ArgumentsTuple;
     typedef typename Events_::Listener Listener;
@@ -69,6 +117,26 @@ public:
         handleEventMessage(tag, _message, typename make_sequence<sizeof...(Arguments_)>::type());
     }
 
+    virtual bool sharesEventDecoding(const ProxyConnection::EventHandler *_other) const {
+        auto other = dynamic_cast<const EventDecoding<Arguments_...> *>(_other);
+        return (other != nullptr
+                && hasSameDeployments(other->getArguments(),
+                        typename make_sequence<sizeof...(Arguments_)>::type()));
+    }
+
+    virtual std::shared_ptr<const void> decodeEventMessage(const Message &_message) {
+        return decodeEventMessage(_message, typename make_sequence<sizeof...(Arguments_)>::type());
+    }
+
+    virtual void onDecodedEventMessage(const std::shared_ptr<const void> &_arguments) {
+        handleDecodedEventMessage(*std::static_pointer_cast<const std::tuple<Arguments_...>>(_arguments),
+                typename make_sequence<sizeof...(Arguments_)>::type());
+    }
+
+    virtual const std::tuple<Arguments_...> &getArguments() const {
+        return arguments_;
+    }
+
 protected:
     virtual void onFirstListenerAdded(const Listener&) {
         auto major = proxy_.getSomeIpAddress().getMajorVersion();
@@ -99,6 +167,37 @@ protected:
         }
     }
 
+    template<int ... Indices_>
+    inline bool hasSameDeployments(const std::tuple<Arguments_...> &_arguments,
+                                   index_sequence<Indices_...>) const {
+        (void)_arguments;
+        bool itsResult(true);
+        (void)std::initializer_list<int>{ (itsResult = itsResult
+                && hasSameDeployment(std::get<Indices_>(arguments_), std::get<Indices_>(_arguments)), 0)... };
+        return itsResult;
+    }
+
+    template<int ... Indices_>
+    inline std::shared_ptr<const void> decodeEventMessage(const Message &_message,
+                                                          index_sequence<Indices_...>) {
+        auto itsArguments = std::make_shared<std::tuple<Arguments_...>>(
+                copyDeployment(std::get<Indices_>(arguments_))...);
+        InputStream InputStream(_message);
+        if (SerializableArguments<Arguments_...>::deserialize(
+                InputStream, std::get<Indices_>(*itsArguments)...)) {
+            return itsArguments;
+        }
+        COMMONAPI_ERROR("CommonAPI::SomeIP::Event: deserialization failed!");
+        return nullptr;
+    }
+
+    template<int ... Indices_>
+    inline void handleDecodedEventMessage(const std::tuple<Arguments_...> &_arguments,
+                                          index_sequence<Indices_...>) {
+        (void)_arguments;
+        this->notifyListeners(getArgumentValue(std::get<Indices_>(_arguments))...);
+    }
+
     template<int ... Indices_>
     inline void handleEventMessage(uint32_t _tag, const Message &_message,
                                    index_sequence<Indices_...>) {
@@ -0,0 +1,189 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_FIXED_LAYOUT_HPP_
+#define COMMONAPI_SOMEIP_FIXED_LAYOUT_HPP_
+
+#if defined(LINUX)
+#include <endian.h>
+#elif defined(FREEBSD)
+#include <sys/endian.h>
+#endif
+
+#include <cstring>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+
+#include <CommonAPI/Types.hpp>
+
+#include <CommonAPI/SomeIP/ByteOrder.hpp>
+#include <CommonAPI/SomeIP/Deployment.hpp>
+#include <CommonAPI/SomeIP/Helper.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+template<typename Base_>
+Base_ getEnumerationBase(const Enumeration<Base_> *);
+void getEnumerationBase(...);
+
+/**
+ * The type that represents Type_ on the wire if Type_ is written without
+ * deployment: Type_ itself for arithmetic types, the base type for
+ * enumerations and void for all other types.
+ */
+template<typename Type_, bool IsArithmetic_ = std::is_arithmetic<Type_>::value>
+struct wire_type {
+    typedef Type_ type;
+};
+
+template<typename Type_>
+struct wire_type<Type_, false> {
+    typedef decltype(getEnumerationBase(static_cast<const Type_ *>(nullptr))) type;
+};
+
+/**
+ * A struct member has a fixed layout, if its wire representation does not
+ * depend on its value or on a runtime deployment parameter.
+ */
+template<typename Type_, typename Deployment_>
+struct is_fixed_layout_member
+    : std::integral_constant<bool,
+        is_bulk_serializable<typename wire_type<Type_>::type>::value
+        && std::is_same<Deployment_, EmptyDeployment>::value> {
+};
+
+template<bool... Values_>
+struct bool_sequence {
+};
+
+template<bool... Values_>
+struct all_of
+    : std::is_same<bool_sequence<true, Values_...>, bool_sequence<Values_..., true>> {
+};
+
+/**
+ * Marks the structs whose wire representation is a compile time constant
+ * sequence of arithmetic values (apart from an optional length field, which
+ * must be checked at runtime). Such structs are (de-)serialized with one
+ * bounds check instead of one call per member.
+ */
+template<typename Values_, typename Deployment_>
+struct is_fixed_layout_struct
+    : std::false_type {
+};
+
+template<typename... Types_>
+struct is_fixed_layout_struct<std::tuple<Types_...>, EmptyDeployment>
+    : all_of<is_fixed_layout_member<Types_, EmptyDeployment>::value...> {
+};
+
+template<typename... Types_, typename... Deployments_>
+struct is_fixed_layout_struct<std::tuple<Types_...>, StructDeployment<Deployments_...>>
+    : all_of<is_fixed_layout_member<Types_, Deployments_>::value...> {
+};
+
+template<typename... Types_>
+struct FixedLayout;
+
+template<>
+struct FixedLayout<> {
+    static const size_t size = 0;
+};
+
+template<typename Type_, typename... Rest_>
+struct FixedLayout<Type_, Rest_...> {
+    static const size_t size = sizeof(typename wire_type<Type_>::type) + FixedLayout<Rest_...>::size;
+};
+
+/**
+ * Writes/reads the members of a fixed layout struct to/from a buffer of
+ * FixedLayout<Types_...>::size bytes.
+ */
+struct FixedLayoutCodec {
+    template<typename... Types_>
+    static void write(byte_t *_target, const Struct<Types_...> &_value) {
+        write(_target, _value, typename make_sequence<sizeof...(Types_)>::type());
+    }
+
+    template<typename... Types_>
+    static void read(const byte_t *_source, Struct<Types_...> &_value) {
+        read(_source, _value, typename make_sequence<sizeof...(Types_)>::type());
+    }
+
+private:
+    template<typename... Types_, int... Indices_>
+    static void write(byte_t *_target, const Struct<Types_...> &_value, index_sequence<Indices_...>) {
+        (void)_target;
+        (void)_value;
+        (void)std::initializer_list<int>{
+            (writeMember(_target, std::get<Indices_>(_value.values_)), 0)... };
+    }
+
+    template<typename... Types_, int... Indices_>
+    static void read(const byte_t *_source, Struct<Types_...> &_value, index_sequence<Indices_...>) {
+        (void)_source;
+        (void)_value;
+        (void)std::initializer_list<int>{
+            (readMember(_source, std::get<Indices_>(_value.values_)), 0)... };
+    }
+
+    template<typename Type_>
+    static void writeMember(byte_t *&_target, const Type_ &_value) {
+        typedef typename wire_type<Type_>::type Wire;
+        union {
+            Wire typed;
+            byte_t raw[sizeof(Wire)];
+        } value;
+        value.typed = static_cast<Wire>(_value);
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        for (size_t i = 0; i < sizeof(Wire); ++i) {
+            _target[i] = value.raw[sizeof(Wire) - 1 - i];
+        }
+#else
+        std::memcpy(_target, value.raw, sizeof(Wire));
+#endif
+        _target += sizeof(Wire);
+    }
+
+    template<typename Type_>
+    static void readMember(const byte_t *&_source, Type_ &_value) {
+        typedef typename wire_type<Type_>::type Wire;
+        union {
+            Wire typed;
+            byte_t raw[sizeof(Wire)];
+        } value;
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        for (size_t i = 0; i < sizeof(Wire); ++i) {
+            value.raw[i] = _source[sizeof(Wire) - 1 - i];
+        }
+#else
+        std::memcpy(value.raw, _source, sizeof(Wire));
+#endif
+        assign(_value, value.typed);
+        _source += sizeof(Wire);
+    }
+
+    template<typename Type_>
+    static typename std::enable_if<std::is_arithmetic<Type_>::value>::type
+    assign(Type_ &_value, const Type_ &_wire) {
+        _value = _wire;
+    }
+
+    template<typename Base_>
+    static void assign(Enumeration<Base_> &_value, const Base_ &_wire) {
+        _value = _wire;
+    }
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_FIXED_LAYOUT_HPP_
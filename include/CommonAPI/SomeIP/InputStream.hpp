@@ -11,8 +11,13 @@
 #define COMMONAPI_SOMEIP_INPUT_STREAM_HPP_
 
 #include <CommonAPI/InputStream.hpp>
+#include <CommonAPI/SomeIP/ByteBufferView.hpp>
+#include <CommonAPI/SomeIP/ByteOrder.hpp>
 #include <CommonAPI/SomeIP/Message.hpp>
 #include <CommonAPI/SomeIP/Deployment.hpp>
+#include <CommonAPI/SomeIP/FixedLayout.hpp>
+#include <CommonAPI/SomeIP/SerializedSize.hpp>
+#include <CommonAPI/SomeIP/StringView.hpp>
 
 #if defined(LINUX)
 #include <endian.h>
@@ -23,8 +28,10 @@
 #endif
 
 #include <stdint.h>
+#include <algorithm>
 #include <cassert>
 #include <cstring> // memset
+#include <limits>
 #include <string>
 #include <vector>
 #include <stack>
@@ -64,6 +71,12 @@ public:
     COMMONAPI_EXPORT virtual InputStream &readValue(std::string &_value, const StringDeployment *_depl);
     COMMONAPI_EXPORT virtual InputStream &readValue(ByteBuffer &_value, const ByteBufferDeployment *_depl);
 
+    COMMONAPI_EXPORT InputStream &readValue(ByteBufferView &_value, const EmptyDeployment *_depl);
+    COMMONAPI_EXPORT InputStream &readValue(ByteBufferView &_value, const ByteBufferDeployment *_depl);
+
+    COMMONAPI_EXPORT InputStream &readValue(StringView &_value, const EmptyDeployment *_depl);
+    COMMONAPI_EXPORT InputStream &readValue(StringView &_value, const StringDeployment *_depl);
+
     COMMONAPI_EXPORT virtual InputStream &readValue(Version &_value, const EmptyDeployment *_depl);
 
     COMMONAPI_EXPORT virtual InputStream &readValue(uint32_t &_value, const uint8_t &_width, const bool &_permitZeroWidth);
@@ -107,9 +120,8 @@ public:
     COMMONAPI_EXPORT InputStream &readValue(Struct<Types_...> &_value,
                            const EmptyDeployment *_depl) {
         if (!hasError()) {
-            const auto itsFieldSize(std::tuple_size<std::tuple<Types_...>>::value);
-            StructReader<itsFieldSize-1, InputStream, Struct<Types_...>, EmptyDeployment>{}(
-                (*this), _value, _depl);
+            _readMembers(_value, _depl,
+                is_fixed_layout_struct<std::tuple<Types_...>, EmptyDeployment>());
         }
         return (*this);
     }
@@ -127,9 +139,8 @@ public:
         if (!hasError()) {
             size_t remainingBeforeRead = remaining_;
 
-            const auto itsFieldSize(std::tuple_size<std::tuple<Types_...>>::value);
-            StructReader<itsFieldSize-1, InputStream, Struct<Types_...>, Deployment_>{}(
-                (*this), _value, _depl);
+            _readMembers(_value, _depl,
+                is_fixed_layout_struct<std::tuple<Types_...>, Deployment_>());
 
             if (structLengthWidth != 0) {
                 size_t deserialized = remainingBeforeRead - remaining_;
@@ -216,27 +227,14 @@ public:
         // Read array size
         readValue(itsSize, arrayLengthWidth, true);
 
-        // Reset target
-        _value.clear();
-
-        // Read elements, if reading size has been successful
-        if (!hasError()) {
-            while (itsSize > 0 || (arrayLengthWidth == 0 && _value.size() < arrayMaxLength)) {
-
-                size_t remainingBeforeRead = remaining_;
-
-                ElementType_ itsElement;
-                readValue(itsElement, (_depl ? _depl->elementDepl_ : nullptr));
-                if (hasError()) {
-                    break;
-                }
-
-                _value.push_back(std::move(itsElement));
-
-                if (arrayLengthWidth != 0) {
-                    itsSize -= uint32_t(remainingBeforeRead - remaining_);
-                }
-            }
+        // Read elements, if reading size has been successful. The elements
+        // are read into the existing ones to reuse their memory.
+        if (hasError()) {
+            _value.clear();
+        } else {
+            _readElements(_value, itsSize, arrayLengthWidth, arrayMaxLength,
+                (_depl ? _depl->elementDepl_ : nullptr),
+                std::integral_constant<bool, is_bulk_serializable<ElementType_>::value>());
 
             if (arrayLengthWidth != 0) {
                 if (itsSize != 0) {
@@ -265,11 +263,16 @@ public:
                            ValueType_, HasherType_> &_value,
                            const EmptyDeployment *_depl) {
 
-        typedef typename std::unordered_map<KeyType_, ValueType_, HasherType_>::value_type MapElement;
+        typedef Struct<KeyType_, ValueType_> MapElement;
 
         uint32_t itsSize;
         _readValue(itsSize);
 
+        _value.clear();
+        if (!hasError()) {
+            _reserveElements<MapElement>(_value, itsSize, std::numeric_limits<size_t>::max());
+        }
+
         while (itsSize > 0) {
             size_t remainingBeforeRead = remaining_;
 
@@ -285,7 +288,7 @@ public:
                 break;
             }
 
-            _value.insert(MapElement(std::move(itsKey), std::move(itsValue)));
+            _value.emplace(std::move(itsKey), std::move(itsValue));
 
             itsSize -= uint32_t(remainingBeforeRead - remaining_);
         }
@@ -302,11 +305,16 @@ public:
                            ValueType_, HasherType_> &_value,
                            const Deployment_ *_depl) {
 
-        typedef typename std::unordered_map<KeyType_, ValueType_, HasherType_>::value_type MapElement;
+        typedef Struct<KeyType_, ValueType_> MapElement;
 
         uint32_t itsSize;
         _readValue(itsSize);
 
+        _value.clear();
+        if (!hasError()) {
+            _reserveElements<MapElement>(_value, itsSize, std::numeric_limits<size_t>::max());
+        }
+
         while (itsSize > 0) {
             size_t remainingBeforeRead = remaining_;
 
@@ -322,7 +330,7 @@ public:
                 break;
             }
 
-            _value.insert(MapElement(std::move(itsKey), std::move(itsValue)));
+            _value.emplace(std::move(itsKey), std::move(itsValue));
 
             itsSize -= uint32_t(remainingBeforeRead - remaining_);
         }
@@ -416,6 +424,118 @@ public:
     }
 
 private:
+    /**
+     * Reads the length field and the BOM of a string. Returns a pointer to the
+     * string content within the message body; _size is set to the length of
+     * the content without BOM and termination.
+     */
+    COMMONAPI_EXPORT byte_t *_readString(uint32_t &_size, const StringDeployment *_depl);
+    COMMONAPI_EXPORT bool _decodeString(byte_t *_data, uint32_t _size,
+                                        StringEncoding _encoding, std::string &_value);
+
+    template<typename Deployment_, typename... Types_>
+    COMMONAPI_EXPORT void _readMembers(Struct<Types_...> &_value,
+                                       const Deployment_ *_depl, std::false_type) {
+        const auto itsFieldSize(std::tuple_size<std::tuple<Types_...>>::value);
+        StructReader<itsFieldSize-1, InputStream, Struct<Types_...>, Deployment_>{}(
+            (*this), _value, _depl);
+    }
+
+    // Members of fixed layout structs are read as one block
+    template<typename Deployment_, typename... Types_>
+    COMMONAPI_EXPORT void _readMembers(Struct<Types_...> &_value,
+                                       const Deployment_ *, std::true_type) {
+        const size_t itsSize(FixedLayout<Types_...>::size);
+        if (itsSize > remaining_) {
+            errorOccurred_ = true;
+            return;
+        }
+        FixedLayoutCodec::read(_readRaw(itsSize), _value);
+    }
+
+    template<typename ElementType_, typename ElementDepl_>
+    COMMONAPI_EXPORT void _readElements(std::vector<ElementType_> &_value,
+                                        uint32_t &_size, uint8_t _lengthWidth, uint32_t _maxLength,
+                                        const ElementDepl_ *_depl, std::false_type) {
+        if (_lengthWidth != 0) {
+            _reserveElements<ElementType_>(_value, _size, std::numeric_limits<size_t>::max());
+        } else {
+            _reserveElements<ElementType_>(_value, remaining_, _maxLength);
+        }
+
+        size_t itsCount(0);
+        while (_size > 0 || (_lengthWidth == 0 && itsCount < _maxLength)) {
+
+            size_t remainingBeforeRead = remaining_;
+
+            if (itsCount == _value.size()) {
+                _value.emplace_back();
+            }
+            _readElement(_value, itsCount, _depl);
+            if (hasError()) {
+                break;
+            }
+            itsCount++;
+
+            if (_lengthWidth != 0) {
+                _size -= uint32_t(remainingBeforeRead - remaining_);
+            }
+        }
+
+        _value.resize(itsCount);
+    }
+
+    template<typename ElementType_, typename ElementDepl_>
+    COMMONAPI_EXPORT void _readElement(std::vector<ElementType_> &_value, size_t _index,
+                                       const ElementDepl_ *_depl) {
+        readValue(_value[_index], _depl);
+    }
+
+    template<typename ElementDepl_>
+    COMMONAPI_EXPORT void _readElement(std::vector<bool> &_value, size_t _index,
+                                       const ElementDepl_ *_depl) {
+        bool itsElement;
+        readValue(itsElement, _depl);
+        _value[_index] = itsElement;
+    }
+
+    /**
+     * Reserves room for at most _maxCount elements of a container whose
+     * elements are serialized within the next _length bytes. The length is
+     * limited by the remaining bytes, so that a corrupt length field cannot
+     * trigger huge allocations.
+     */
+    template<typename ElementType_, typename Container_>
+    COMMONAPI_EXPORT void _reserveElements(Container_ &_container, size_t _length, size_t _maxCount) {
+        const size_t itsMinimum = SerializedValueSize::getMinimum<ElementType_>();
+        if (itsMinimum > 0) {
+            _container.reserve(std::min(std::min(_length, remaining_) / itsMinimum, _maxCount));
+        }
+    }
+
+    // Arithmetic elements are read as one block
+    template<typename ElementType_, typename ElementDepl_>
+    COMMONAPI_EXPORT void _readElements(std::vector<ElementType_> &_value,
+                                        uint32_t &_size, uint8_t _lengthWidth, uint32_t _maxLength,
+                                        const ElementDepl_ *, std::true_type) {
+        size_t itsCount = (_lengthWidth != 0 ? _size / sizeof(ElementType_) : _maxLength);
+        size_t itsLength = itsCount * sizeof(ElementType_);
+
+        if ((_lengthWidth != 0 && itsLength != _size) || itsLength > remaining_) {
+            errorOccurred_ = true;
+            return;
+        }
+
+        _value.resize(itsCount);
+        if (itsCount > 0) {
+            copyByteOrdered(reinterpret_cast<byte_t *>(_value.data()),
+                            _readRaw(itsLength), itsCount, sizeof(ElementType_));
+        }
+        if (_lengthWidth != 0) {
+            _size = 0;
+        }
+    }
+
     byte_t* dataBegin_;
     byte_t* current_;
     size_t remaining_;
@@ -423,6 +543,24 @@ private:
     bool errorOccurred_;
 };
 
+inline InputStream &operator>>(InputStream &_input, ByteBufferView &_value) {
+    return _input.readValue(_value, static_cast<const ByteBufferDeployment *>(nullptr));
+}
+
+template<typename Deployment_>
+inline InputStream &operator>>(InputStream &_input, Deployable<ByteBufferView, Deployment_> &_value) {
+    return _input.readValue(_value.getValue(), _value.getDepl());
+}
+
+inline InputStream &operator>>(InputStream &_input, StringView &_value) {
+    return _input.readValue(_value, static_cast<const StringDeployment *>(nullptr));
+}
+
+template<typename Deployment_>
+inline InputStream &operator>>(InputStream &_input, Deployable<StringView, Deployment_> &_value) {
+    return _input.readValue(_value.getValue(), _value.getDepl());
+}
+
 } // namespace SomeIP
 } // namespace CommonAPI
 
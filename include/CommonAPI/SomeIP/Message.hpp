@@ -11,6 +11,7 @@
 #define COMMONAPI_SOMEIP_MESSAGE_HPP_
 
 #include <string>
+#include <vector>
 
 #include <vsomeip/vsomeip.hpp>
 
@@ -64,6 +65,11 @@ class Message {
     COMMONAPI_EXPORT session_id_t getSessionId() const;
 
     COMMONAPI_EXPORT void setPayloadData(const byte_t *data, message_length_t length);
+    COMMONAPI_EXPORT void setPayloadData(std::vector<byte_t> &&_data);
+
+    // Payloads are shared, not copied, and must not be changed afterwards
+    COMMONAPI_EXPORT std::shared_ptr<vsomeip::payload> getPayload() const;
+    COMMONAPI_EXPORT void setPayload(const std::shared_ptr<vsomeip::payload> &_payload);
 
  private:
     std::shared_ptr<vsomeip::message> message_;
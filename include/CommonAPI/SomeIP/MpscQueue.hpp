@@ -0,0 +1,89 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_MPSC_QUEUE_HPP_
+#define COMMONAPI_SOMEIP_MPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <utility>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class MpscQueue
+ *
+ * Unbounded multi-producer/single-consumer queue. Pushing is wait-free: a
+ * producer links its node with a single atomic exchange and never waits for
+ * the consumer or other producers. Only a single thread may pop.
+ *
+ * A pushed value becomes visible to the consumer when its producer has
+ * completed the push. Until then, the queue is not empty, but #pop might
+ * still fail.
+ */
+template<typename Value_>
+class MpscQueue {
+public:
+    MpscQueue()
+        : head_(new Node()), tail_(head_.load()) {
+    }
+
+    ~MpscQueue() {
+        Value_ itsValue;
+        while (pop(itsValue))
+            ;
+        delete tail_;
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    // May be called by any thread
+    void push(Value_ _value) {
+        Node *itsNode = new Node(std::move(_value));
+        Node *itsPrevious = head_.exchange(itsNode);
+        itsPrevious->next_.store(itsNode, std::memory_order_release);
+    }
+
+    // Must only be called by the consumer
+    bool pop(Value_ &_value) {
+        Node *itsNext = tail_->next_.load(std::memory_order_acquire);
+        if (!itsNext) {
+            return false;
+        }
+        _value = std::move(itsNext->value_);
+        delete tail_;
+        tail_ = itsNext;
+        return true;
+    }
+
+    // Must only be called by the consumer
+    bool empty() const {
+        return (head_.load() == tail_);
+    }
+
+private:
+    struct Node {
+        Node() : next_(nullptr), value_() {}
+        explicit Node(Value_ &&_value) : next_(nullptr), value_(std::move(_value)) {}
+
+        std::atomic<Node *> next_;
+        Value_ value_;
+    };
+
+    // Producers append at the head, the consumer removes at the tail. The
+    // tail node is a dummy whose value has been consumed already.
+    std::atomic<Node *> head_;
+    Node *tail_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_MPSC_QUEUE_HPP_
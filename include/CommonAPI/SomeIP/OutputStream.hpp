@@ -15,15 +15,19 @@
 #include <iomanip>
 #include <limits>
 #include <memory>
-#include <stack>
 #include <string>
 #include <vector>
 
 #include <CommonAPI/Export.hpp>
 #include <CommonAPI/OutputStream.hpp>
 
+#include <CommonAPI/SomeIP/ByteBufferView.hpp>
+#include <CommonAPI/SomeIP/StringView.hpp>
+#include <CommonAPI/SomeIP/ByteOrder.hpp>
 #include <CommonAPI/SomeIP/Message.hpp>
 #include <CommonAPI/SomeIP/Deployment.hpp>
+#include <CommonAPI/SomeIP/FixedLayout.hpp>
+#include <CommonAPI/SomeIP/PayloadBuffer.hpp>
 
 namespace CommonAPI {
 namespace SomeIP {
@@ -76,8 +80,14 @@ public:
     COMMONAPI_EXPORT virtual OutputStream &writeValue(const std::string &_value, const EmptyDeployment *_depl);
     COMMONAPI_EXPORT virtual OutputStream &writeValue(const std::string &_value, const StringDeployment *_depl);
 
+    COMMONAPI_EXPORT OutputStream &writeValue(const StringView &_value, const EmptyDeployment *_depl);
+    COMMONAPI_EXPORT OutputStream &writeValue(const StringView &_value, const StringDeployment *_depl);
+
     COMMONAPI_EXPORT virtual OutputStream &writeValue(const ByteBuffer &_value, const ByteBufferDeployment *_depl);
 
+    COMMONAPI_EXPORT OutputStream &writeValue(const ByteBufferView &_value, const EmptyDeployment *_depl);
+    COMMONAPI_EXPORT OutputStream &writeValue(const ByteBufferView &_value, const ByteBufferDeployment *_depl);
+
     COMMONAPI_EXPORT virtual OutputStream &writeValue(const Version &_value, const EmptyDeployment *_depl);
 
     COMMONAPI_EXPORT virtual OutputStream &_writeValue(const uint32_t &_value, const uint8_t &_width);
@@ -123,8 +133,8 @@ public:
         // don't write length field as default length width is 0
         if(!hasError()) {
             // Write struct content
-            const auto itsSize(std::tuple_size<std::tuple<Types_...>>::value);
-            StructWriter<itsSize-1, OutputStream, Struct<Types_...>, EmptyDeployment>{}((*this), _value, _depl);
+            _writeMembers(_value, _depl,
+                is_fixed_layout_struct<std::tuple<Types_...>, EmptyDeployment>());
         }
         return (*this);
     }
@@ -143,8 +153,8 @@ public:
 
         if(!hasError()) {
             // Write struct content
-            const auto itsSize(std::tuple_size<std::tuple<Types_...>>::value);
-            StructWriter<itsSize-1, OutputStream, Struct<Types_...>, Deployment_>{}((*this), _value, _depl);
+            _writeMembers(_value, _depl,
+                is_fixed_layout_struct<std::tuple<Types_...>, Deployment_>());
         }
 
         // Write actual value of length field
@@ -252,12 +262,8 @@ public:
 
         if (!hasError()) {
             // Write array/vector content
-            for (auto i : _value) {
-                writeValue(i, (_depl ? _depl->elementDepl_ : nullptr));
-                if (hasError()) {
-                    break;
-                }
-            }
+            _writeElements(_value, (_depl ? _depl->elementDepl_ : nullptr),
+                std::integral_constant<bool, is_bulk_serializable<ElementType_>::value>());
         }
 
         // Write actual value of length field
@@ -326,18 +332,19 @@ public:
 
     /**
      * Writes the data that was buffered within this #OutputMessageStream to the #Message that was given to the constructor. Each call to flush()
-     * will completely override the data that currently is contained in the #Message. The data that is buffered in this #OutputMessageStream is
-     * not deleted by calling flush().
+     * will completely override the data that currently is contained in the #Message. Small payloads are copied from the storage embedded into
+     * the stream, larger ones are handed over to the payload of the #Message without copying. The stream is empty after calling flush().
      */
     COMMONAPI_EXPORT void flush();
 
     /**
      * Reserves the given number of bytes for writing, thereby negating the need to dynamically allocate memory while writing.
      * Use this method for optimization: If possible, reserve as many bytes as you need for your data before doing any writing.
+     * #SerializedSize computes the number of bytes needed to write a list of arguments.
      *
-     * @param numOfBytes The number of bytes that should be reserved for writing.
+     * @param _numOfBytes The number of bytes that should be reserved for writing in addition to the bytes already written.
      */
-    COMMONAPI_EXPORT void reserveMemory(size_t numOfBytes);
+    COMMONAPI_EXPORT void reserveMemory(size_t _numOfBytes);
 
     template<typename Type_>
     COMMONAPI_EXPORT OutputStream &_writeValue(const Type_ &_value) {
@@ -346,15 +353,14 @@ public:
             byte_t raw[sizeof(Type_)];
         } value;
         value.typed = _value;
+        byte_t *target = _appendRaw(sizeof(Type_));
     #if __BYTE_ORDER == __LITTLE_ENDIAN
         byte_t *source = &value.raw[sizeof(Type_)-1];
         for (size_t i = 0; i < sizeof(Type_); ++i) {
-            _writeRaw(*source--);
+            *target++ = *source--;
         }
     #else
-        for (size_t i = 0; i < sizeof(Type_); ++i) {
-            _writeRaw(value.raw[i]);
-        }
+        std::memcpy(target, value.raw, sizeof(Type_));
     #endif
         return (*this);
     }
@@ -416,10 +422,52 @@ public:
 
     COMMONAPI_EXPORT void _writeBom(const StringDeployment *_depl);
 
+    /**
+     * Appends _size bytes to the stream and returns a pointer to them. The caller
+     * is responsible to fill them before any other value is written.
+     */
+    COMMONAPI_EXPORT byte_t *_appendRaw(const size_t _size);
+
 protected:
-    std::vector<byte_t> payload_;
+    PayloadBuffer payload_;
 
 private:
+    template<typename Deployment_, typename... Types_>
+    COMMONAPI_EXPORT void _writeMembers(const Struct<Types_...> &_value,
+                                        const Deployment_ *_depl, std::false_type) {
+        const auto itsSize(std::tuple_size<std::tuple<Types_...>>::value);
+        StructWriter<itsSize-1, OutputStream, Struct<Types_...>, Deployment_>{}((*this), _value, _depl);
+    }
+
+    // Members of fixed layout structs are written as one block
+    template<typename Deployment_, typename... Types_>
+    COMMONAPI_EXPORT void _writeMembers(const Struct<Types_...> &_value,
+                                        const Deployment_ *, std::true_type) {
+        FixedLayoutCodec::write(_appendRaw(FixedLayout<Types_...>::size), _value);
+    }
+
+    template<typename ElementType_, typename ElementDepl_>
+    COMMONAPI_EXPORT void _writeElements(const std::vector<ElementType_> &_value,
+                                         const ElementDepl_ *_depl, std::false_type) {
+        for (const auto &i : _value) {
+            writeValue(i, _depl);
+            if (hasError()) {
+                break;
+            }
+        }
+    }
+
+    // Arithmetic elements are written as one block
+    template<typename ElementType_, typename ElementDepl_>
+    COMMONAPI_EXPORT void _writeElements(const std::vector<ElementType_> &_value,
+                                         const ElementDepl_ *, std::true_type) {
+        if (!_value.empty()) {
+            copyByteOrdered(_appendRaw(_value.size() * sizeof(ElementType_)),
+                            reinterpret_cast<const byte_t *>(_value.data()),
+                            _value.size(), sizeof(ElementType_));
+        }
+    }
+
     COMMONAPI_EXPORT size_t getPosition();
     COMMONAPI_EXPORT void pushPosition();
     COMMONAPI_EXPORT size_t popPosition();
@@ -427,9 +475,32 @@ private:
     Message message_;
     bool errorOccurred_;
 
-    std::stack<size_t> positions_;
+    // Positions of the length fields that are currently open. Nesting deeper
+    // than INLINE_POSITIONS levels is stored in morePositions_.
+    static const size_t INLINE_POSITIONS = 16;
+    size_t positions_[INLINE_POSITIONS];
+    size_t numPositions_;
+    std::vector<size_t> morePositions_;
 };
 
+inline OutputStream &operator<<(OutputStream &_output, const ByteBufferView &_value) {
+    return _output.writeValue(_value, static_cast<const ByteBufferDeployment *>(nullptr));
+}
+
+template<typename Deployment_>
+inline OutputStream &operator<<(OutputStream &_output, const Deployable<ByteBufferView, Deployment_> &_value) {
+    return _output.writeValue(_value.getValue(), _value.getDepl());
+}
+
+inline OutputStream &operator<<(OutputStream &_output, const StringView &_value) {
+    return _output.writeValue(_value, static_cast<const StringDeployment *>(nullptr));
+}
+
+template<typename Deployment_>
+inline OutputStream &operator<<(OutputStream &_output, const Deployable<StringView, Deployment_> &_value) {
+    return _output.writeValue(_value.getValue(), _value.getDepl());
+}
+
 } // namespace SomeIP
 } // namespace CommonAPI
 
@@ -0,0 +1,101 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_PACKED_KEY_TABLE_HPP_
+#define COMMONAPI_SOMEIP_PACKED_KEY_TABLE_HPP_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <CommonAPI/SomeIP/Types.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+inline uint64_t packKey(service_id_t _service, instance_id_t _instance) {
+    return (uint64_t(_service) << 16) | uint64_t(_instance);
+}
+
+inline uint64_t packKey(service_id_t _service, instance_id_t _instance, event_id_t _event) {
+    return (uint64_t(_service) << 32) | (uint64_t(_instance) << 16) | uint64_t(_event);
+}
+
+/**
+ * @class PackedKeyTable
+ *
+ * Immutable hash table that maps packed SOME/IP identifiers to values. The
+ * entries are stored in a single array (open addressing, linear probing),
+ * so a lookup neither allocates nor follows more than one pointer. Meant to
+ * be published by #ReadCopyUpdate and rebuilt on change.
+ */
+template<typename Value_>
+class PackedKeyTable {
+public:
+    PackedKeyTable()
+        : mask_(0) {
+    }
+
+    explicit PackedKeyTable(const std::vector<std::pair<uint64_t, Value_>> &_entries) {
+        size_t itsCapacity(8);
+        while (itsCapacity < 2 * _entries.size()) {
+            itsCapacity *= 2;
+        }
+        entries_.resize(itsCapacity);
+        mask_ = itsCapacity - 1;
+
+        for (const auto &e : _entries) {
+            size_t i = getSlot(e.first);
+            while (entries_[i].isUsed_ && entries_[i].key_ != e.first) {
+                i = (i + 1) & mask_;
+            }
+            entries_[i].key_ = e.first;
+            entries_[i].isUsed_ = true;
+            entries_[i].value_ = e.second;
+        }
+    }
+
+    const Value_ *find(uint64_t _key) const {
+        if (entries_.empty()) {
+            return nullptr;
+        }
+
+        size_t i = getSlot(_key);
+        while (entries_[i].isUsed_) {
+            if (entries_[i].key_ == _key) {
+                return &entries_[i].value_;
+            }
+            i = (i + 1) & mask_;
+        }
+        return nullptr;
+    }
+
+private:
+    struct Entry {
+        Entry() : key_(0), isUsed_(false), value_() {}
+
+        uint64_t key_;
+        bool isUsed_;
+        Value_ value_;
+    };
+
+    size_t getSlot(uint64_t _key) const {
+        _key ^= (_key >> 29);
+        _key *= 0x9E3779B97F4A7C15ULL;
+        return size_t(_key >> 32) & mask_;
+    }
+
+    std::vector<Entry> entries_;
+    size_t mask_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_PACKED_KEY_TABLE_HPP_
@@ -0,0 +1,127 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_PAYLOAD_BUFFER_HPP_
+#define COMMONAPI_SOMEIP_PAYLOAD_BUFFER_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <CommonAPI/SomeIP/Types.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class PayloadBuffer
+ *
+ * Growable byte buffer used by the #OutputStream. Payloads of up to
+ * INLINE_SIZE bytes are kept in storage embedded into the buffer object, so
+ * that serializing them does not allocate memory. As soon as a payload
+ * outgrows the embedded storage, it is moved into a vector that can be handed
+ * over to the message without copying.
+ */
+class PayloadBuffer {
+public:
+    static const size_t INLINE_SIZE = 256;
+
+    PayloadBuffer()
+        : size_(0), isInline_(true) {
+    }
+
+    PayloadBuffer(const PayloadBuffer &) = delete;
+    PayloadBuffer &operator=(const PayloadBuffer &) = delete;
+
+    byte_t *data() { return (isInline_ ? inline_ : external_.data()); }
+    const byte_t *data() const { return (isInline_ ? inline_ : external_.data()); }
+    size_t size() const { return size_; }
+    bool isInline() const { return isInline_; }
+
+    byte_t &operator[](size_t _position) { return data()[_position]; }
+
+    void reserve(size_t _capacity) {
+        if (isInline_) {
+            if (_capacity > INLINE_SIZE) {
+                spill(_capacity);
+            }
+        } else {
+            external_.reserve(_capacity);
+        }
+    }
+
+    /**
+     * Appends _size bytes and returns a pointer to the first of them. The
+     * pointer is valid until the buffer is modified again.
+     */
+    byte_t *append(size_t _size) {
+        const size_t itsPosition(size_);
+        if (isInline_) {
+            if (itsPosition + _size <= INLINE_SIZE) {
+                size_ += _size;
+                return inline_ + itsPosition;
+            }
+            spill(2 * (itsPosition + _size));
+        }
+        external_.resize(itsPosition + _size);
+        size_ += _size;
+        return external_.data() + itsPosition;
+    }
+
+    void append(const byte_t *_data, size_t _size) {
+        if (_size > 0) {
+            std::memcpy(append(_size), _data, _size);
+        }
+    }
+
+    /**
+     * Shrinks the buffer to _size bytes.
+     */
+    void truncate(size_t _size) {
+        if (!isInline_) {
+            external_.resize(_size);
+        }
+        size_ = _size;
+    }
+
+    /**
+     * Hands the content over if it is stored in a vector. The buffer is empty
+     * afterwards.
+     */
+    std::vector<byte_t> release() {
+        std::vector<byte_t> itsContent(std::move(external_));
+        external_.clear();
+        size_ = 0;
+        isInline_ = true;
+        return itsContent;
+    }
+
+    void clear() {
+        external_.clear();
+        size_ = 0;
+        isInline_ = true;
+    }
+
+private:
+    void spill(size_t _capacity) {
+        external_.reserve(_capacity);
+        external_.assign(inline_, inline_ + size_);
+        isInline_ = false;
+    }
+
+    byte_t inline_[INLINE_SIZE];
+    std::vector<byte_t> external_;
+    size_t size_;
+    bool isInline_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_PAYLOAD_BUFFER_HPP_
@@ -0,0 +1,149 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_PENDING_CALL_TABLE_HPP_
+#define COMMONAPI_SOMEIP_PENDING_CALL_TABLE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <vsomeip/application.hpp>
+
+#include <CommonAPI/SomeIP/ProxyConnection.hpp>
+#include <CommonAPI/SomeIP/TimerService.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class PendingCallTable
+ *
+ * Method calls that wait for their reply, indexed by session id. The table is
+ * split into shards that are locked independently, so that registering,
+ * completing and expiring calls of different sessions do not contend.
+ *
+ * The session of a call is assigned while it is sent, hence a call can only
+ * be registered after sending it. Senders bracket send and registration by
+ * beginSend/endSend. A reply that arrives in between is parked and handed
+ * to the sender on registration. Each send is numbered by a generation and
+ * a reply is parked with the latest generation that began sending. Once all
+ * sends up to that generation have ended, no sender can claim the reply any
+ * more and it is dropped.
+ */
+class PendingCallTable {
+public:
+    typedef TimerService::time_point_t time_point_t;
+
+    struct Call {
+        Call() {}
+        Call(const time_point_t &_timeout,
+             const std::shared_ptr<vsomeip::message> &_request,
+             std::unique_ptr<ProxyConnection::MessageReplyAsyncHandler> _handler,
+             const std::shared_ptr<TimerService::Timer> &_timer = nullptr)
+            : timeout_(_timeout), request_(_request), handler_(std::move(_handler)), timer_(_timer) {
+        }
+
+        time_point_t timeout_;
+        std::shared_ptr<vsomeip::message> request_;
+        std::unique_ptr<ProxyConnection::MessageReplyAsyncHandler> handler_;
+        std::shared_ptr<TimerService::Timer> timer_;
+    };
+
+    PendingCallTable();
+
+    PendingCallTable(const PendingCallTable &) = delete;
+    PendingCallTable &operator=(const PendingCallTable &) = delete;
+
+    typedef uint64_t generation_t;
+
+    /**
+     * Returns the generation of the send, which must be passed to insert
+     * and endSend.
+     */
+    generation_t beginSend();
+    void endSend(generation_t _generation);
+
+    /**
+     * Registers a call. If its reply has already arrived while the call was
+     * sent, the reply is returned and must be delivered again.
+     */
+    std::shared_ptr<vsomeip::message> insert(session_id_t _session, Call &&_call,
+            generation_t _generation);
+
+    /**
+     * Removes the call registered for the session of the reply. If there is
+     * none, the reply is parked if it may belong to a call that is currently
+     * being sent. Returns false if no call was found.
+     */
+    bool complete(const std::shared_ptr<vsomeip::message> &_reply, Call &_call);
+
+    /**
+     * Removes the call registered for the given session.
+     */
+    bool remove(session_id_t _session, Call &_call);
+
+    /**
+     * Removes the call registered for the given session if its timeout has
+     * expired. A call that reuses the session of an expired one is kept.
+     */
+    bool takeExpired(session_id_t _session, const time_point_t &_now, Call &_call);
+
+    /**
+     * Returns the request of the call registered for the given session if
+     * its timeout has expired. The call stays registered.
+     */
+    std::shared_ptr<vsomeip::message> getExpired(session_id_t _session, const time_point_t &_now);
+
+private:
+    static const size_t SHARD_COUNT = 16;
+    static const size_t SEND_SLOT_COUNT = 64;
+
+    struct EarlyReply {
+        std::shared_ptr<vsomeip::message> reply_;
+        generation_t generation_;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex_;
+        std::unordered_map<session_id_t, Call> calls_;
+        std::unordered_map<session_id_t, EarlyReply> early_;
+    };
+
+    Shard &getShard(session_id_t _session) {
+        return shards_[_session % SHARD_COUNT];
+    }
+
+    // Drops the parked replies that no current sender can claim
+    void dropEarlyReplies();
+
+    Shard shards_[SHARD_COUNT];
+
+    std::atomic<generation_t> generation_;
+    std::atomic<uint32_t> sending_;
+    std::atomic<uint32_t> parked_;
+
+    // Generations of the sends in progress, zero marks a free slot. Sends
+    // that find all slots taken are recorded in the overflow set.
+    std::atomic<generation_t> sendSlots_[SEND_SLOT_COUNT];
+    std::mutex overflowMutex_;
+    std::set<generation_t> overflow_;
+    std::atomic<uint32_t> overflowCount_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_PENDING_CALL_TABLE_HPP_
@@ -22,6 +22,7 @@
 #include <CommonAPI/Attribute.hpp>
 #include <CommonAPI/Event.hpp>
 #include <CommonAPI/Types.hpp>
+#include <CommonAPI/SomeIP/ClientId.hpp>
 #include <CommonAPI/SomeIP/Constants.hpp>
 #include <CommonAPI/SomeIP/Message.hpp>
 #include <CommonAPI/SomeIP/Types.hpp>
@@ -47,6 +48,13 @@ class ProxyConnection {
         virtual ~EventHandler() { }
         virtual void onEventMessage(const Message&) = 0;
         virtual void onInitialValueEventMessage(const Message &, const uint32_t) {};
+
+        // A notification that is delivered to several handlers is decoded
+        // only once for all handlers that share their decoding. The decoded
+        // value must not be modified. Decoding fails if it returns nullptr.
+        virtual bool sharesEventDecoding(const EventHandler *) const { return false; }
+        virtual std::shared_ptr<const void> decodeEventMessage(const Message &) { return nullptr; }
+        virtual void onDecodedEventMessage(const std::shared_ptr<const void> &) {}
     };
 
     typedef std::tuple< service_id_t, instance_id_t, eventgroup_id_t, event_id_t > EventHandlerIds;
@@ -81,6 +89,12 @@ class ProxyConnection {
                 const Message &message, client_id_t _client,
                 uint32_t *allocatedSerial = NULL) const = 0;
 
+    virtual bool sendEvent(
+                const Message &message,
+                const std::vector<client_id_t> &_clients) const = 0;
+
+    virtual bool sendEvents(const std::vector<Message> &_messages) const = 0;
+
     virtual void addEventHandler(
             service_id_t serviceId,
             instance_id_t instanceId,
@@ -128,6 +142,13 @@ class ProxyConnection {
     virtual void setStubMessageHandler(std::function<bool(const Message&)> stubMessageHandler) = 0;
     virtual bool isStubMessageHandlerSet() = 0;
 
+    // Returns the same object for all requests of a client
+    virtual std::shared_ptr<ClientId> getClientId(client_id_t _client) const = 0;
+
+    // Number of requests rejected by the admission limits of the stub side
+    virtual uint64_t getShedRequestCount(service_id_t _service) const = 0;
+    virtual uint64_t getShedRequestCount(service_id_t _service, method_id_t _method) const = 0;
+
     virtual void sendPendingSubscriptions(service_id_t serviceId,
                                           instance_id_t instanceId,
                                           major_version_t major) = 0;
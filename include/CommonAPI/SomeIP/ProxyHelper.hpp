@@ -14,12 +14,12 @@
 #include <future>
 #include <memory>
 #include <string>
-#include <mutex>
 
 #include <CommonAPI/SomeIP/Message.hpp>
 #include <CommonAPI/SomeIP/ProxyAsyncCallbackHandler.hpp>
 #include <CommonAPI/SomeIP/ProxyConnection.hpp>
 #include <CommonAPI/SomeIP/SerializableArguments.hpp>
+#include <CommonAPI/SomeIP/SerializedSize.hpp>
 #include <CommonAPI/SomeIP/Types.hpp>
 
 namespace CommonAPI {
@@ -30,13 +30,9 @@ class Proxy;
 template <class, class>
 struct ProxyHelper;
 
-#ifdef WIN32
-// Visual Studio 2013 does not support 'magic statics' yet.
-// Change back when switched to Visual Studio 2015 or higher.
-static std::mutex callMethod_mutex_;
-static std::mutex callMethodWithReply_mutex_;
-static std::mutex callMethodAsync_mutex_;
-#endif
+// The method calls do not need to be serialized: each call creates its own
+// message, the session is assigned by the connection while sending and the
+// connection matches each reply to its pending call.
 
 template <
     template <class...> class In_, class... InArgs_,
@@ -50,10 +46,6 @@ template <
             const bool _reliable,
             const InArgs_ &... _inArgs,
             CommonAPI::CallStatus &_callStatus) {
-#ifndef WIN32
-            static std::mutex callMethod_mutex_;
-#endif
-            std::lock_guard<std::mutex> lock(callMethod_mutex_);
             Message methodCall = _proxy.createMethodCall(_methodId, _reliable);
             callMethod(_proxy, methodCall, _inArgs..., _callStatus);
         }
@@ -71,6 +63,7 @@ template <
 
             if (sizeof...(InArgs_) > 0) {
                 OutputStream outputStream(message);
+                outputStream.reserveMemory(SerializedSize<InArgs_...>::get(_inArgs...));
                 const bool success = SerializableArguments<InArgs_...>::serialize(outputStream, _inArgs...);
                 if (!success) {
                     _callStatus = CallStatus::OUT_OF_MEMORY;
@@ -95,6 +88,7 @@ template <
         if (_proxy.isAvailable()) {
             if (sizeof...(InArgs_) > 0) {
                 OutputStream outputStream(_methodCall);
+                outputStream.reserveMemory(SerializedSize<InArgs_...>::get(_inArgs...));
                 const bool success = SerializableArguments<InArgs_...>::serialize(outputStream, _inArgs...);
                 if (!success) {
                     _callStatus = CallStatus::OUT_OF_MEMORY;
@@ -128,6 +122,7 @@ template <
         if (_proxy.isAvailable()) {
             if (sizeof...(InArgs_) > 0) {
                 OutputStream outputStream(_methodCall);
+                outputStream.reserveMemory(SerializedSize<InArgs_...>::get(_inArgs...));
                 const bool success = SerializableArguments<InArgs_...>::serialize(outputStream, _inArgs...);
                 if (!success) {
                     _callStatus = CallStatus::OUT_OF_MEMORY;
@@ -166,10 +161,6 @@ template <
                     const InArgs_&... _inArgs,
                     CommonAPI::CallStatus &_callStatus,
                     OutArgs_&... _outArgs) {
-#ifndef WIN32
-        static std::mutex callMethodWithReply_mutex_;
-#endif
-        std::lock_guard<std::mutex> lock(callMethodWithReply_mutex_);
         Message methodCall = _proxy.createMethodCall(_methodId, _reliable);
         callMethodWithReply(_proxy, methodCall, _info, _inArgs..., _callStatus, _outArgs...);
     }
@@ -183,10 +174,6 @@ template <
                     const InArgs_&... _inArgs,
                     AsyncCallback_ _asyncCallback,
                     std::tuple<OutArgs_...> _outArgs) {
-#ifndef WIN32
-        static std::mutex callMethodAsync_mutex_;
-#endif
-        std::lock_guard<std::mutex> lock(callMethodAsync_mutex_);
         Message methodCall = _proxy.createMethodCall(_methodId, _reliable);
         return callMethodAsync(_proxy, methodCall, _info, _inArgs..., _asyncCallback, _outArgs);
     }
@@ -202,6 +189,7 @@ template <
         if (_proxy.isAvailable()) {
             if (sizeof...(InArgs_) > 0) {
                 OutputStream outputStream(_message);
+                outputStream.reserveMemory(SerializedSize<InArgs_...>::get(_inArgs...));
                 const bool success = SerializableArguments< InArgs_... >::serialize(outputStream, _inArgs...);
                 if (!success) {
                     std::promise<CallStatus> promise;
@@ -0,0 +1,120 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_READ_COPY_UPDATE_HPP_
+#define COMMONAPI_SOMEIP_READ_COPY_UPDATE_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class ReadCopyUpdate
+ *
+ * Holds an immutable value that is read far more often than it is changed.
+ * Readers neither lock nor wait: they announce themselves by incrementing
+ * the reader count of the current epoch and read the current value. Writers
+ * publish a new value, advance the epoch twice and wait until the readers of
+ * both previous epochs are gone before deleting the old value.
+ */
+template<typename Value_>
+class ReadCopyUpdate {
+public:
+    class Reader {
+    public:
+        Reader(Reader &&_other)
+            : readers_(_other.readers_), value_(_other.value_) {
+            _other.readers_ = nullptr;
+        }
+
+        ~Reader() {
+            if (readers_) {
+                readers_->fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        Reader(const Reader &) = delete;
+        Reader &operator=(const Reader &) = delete;
+
+        const Value_ &operator*() const { return *value_; }
+        const Value_ *operator->() const { return value_; }
+
+    private:
+        friend class ReadCopyUpdate;
+
+        Reader(std::atomic<uint32_t> *_readers, const Value_ *_value)
+            : readers_(_readers), value_(_value) {
+        }
+
+        std::atomic<uint32_t> *readers_;
+        const Value_ *value_;
+    };
+
+    ReadCopyUpdate()
+        : value_(new Value_()), epoch_(0) {
+        readers_[0] = 0;
+        readers_[1] = 0;
+    }
+
+    ~ReadCopyUpdate() {
+        delete value_.load();
+    }
+
+    ReadCopyUpdate(const ReadCopyUpdate &) = delete;
+    ReadCopyUpdate &operator=(const ReadCopyUpdate &) = delete;
+
+    /**
+     * Returns a handle to the current value, which stays valid as long as
+     * the handle exists. Handles should be short-living as they delay the
+     * next update.
+     */
+    Reader read() const {
+        std::atomic<uint32_t> *itsReaders = &readers_[epoch_.load() & 1];
+        itsReaders->fetch_add(1);
+        return Reader(itsReaders, value_.load());
+    }
+
+    /**
+     * Replaces the current value. Returns as soon as no reader can access
+     * the old value anymore, hence the calling thread must not hold a
+     * reader itself.
+     */
+    void update(std::unique_ptr<Value_> _value) {
+        std::lock_guard<std::mutex> itsLock(updateMutex_);
+        Value_ *itsOldValue = value_.exchange(_value.release());
+
+        // A reader might have fetched the epoch before the previous update
+        // and the value after it, hence the readers of both epochs are
+        // waited for.
+        for (int i = 0; i < 2; i++) {
+            uint64_t itsEpoch = epoch_.fetch_add(1);
+            while (readers_[itsEpoch & 1].load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        delete itsOldValue;
+    }
+
+private:
+    std::atomic<Value_ *> value_;
+    std::atomic<uint64_t> epoch_;
+    mutable std::atomic<uint32_t> readers_[2];
+    std::mutex updateMutex_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_READ_COPY_UPDATE_HPP_
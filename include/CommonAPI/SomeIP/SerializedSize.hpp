@@ -0,0 +1,330 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_SERIALIZED_SIZE_HPP_
+#define COMMONAPI_SOMEIP_SERIALIZED_SIZE_HPP_
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <CommonAPI/Types.hpp>
+
+#include <CommonAPI/SomeIP/ByteBufferView.hpp>
+#include <CommonAPI/SomeIP/Deployment.hpp>
+#include <CommonAPI/SomeIP/Helper.hpp>
+#include <CommonAPI/SomeIP/StringView.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * Computes the number of bytes the SOME/IP serialization of a value occupies.
+ * The overloads mirror the writeValue methods of #OutputStream. The result is
+ * exact for all types except:
+ * - strings with UTF-16 deployment, where an upper bound is returned, and
+ * - polymorphic structs, where only the serial is taken into account.
+ */
+struct SerializedValueSize {
+    template<typename Type_>
+    static size_t get(const Type_ &_value) {
+        return get(_value, static_cast<const EmptyDeployment *>(nullptr));
+    }
+
+    template<typename Type_, typename Deployment_>
+    static size_t get(const Deployable<Type_, Deployment_> &_value) {
+        return get(_value.getValue(), _value.getDepl());
+    }
+
+    template<typename Type_>
+    static typename std::enable_if<std::is_arithmetic<Type_>::value, size_t>::type
+    get(const Type_ &, const EmptyDeployment *) {
+        return sizeof(Type_);
+    }
+
+    static size_t get(const Version &, const EmptyDeployment *) {
+        return 2 * sizeof(uint32_t);
+    }
+
+    static size_t get(const std::string &_value, const EmptyDeployment *) {
+        return get(_value, static_cast<const StringDeployment *>(nullptr));
+    }
+
+    static size_t get(const std::string &_value, const StringDeployment *_depl) {
+        return get(StringView(_value), _depl);
+    }
+
+    static size_t get(const StringView &_value, const EmptyDeployment *) {
+        return get(_value, static_cast<const StringDeployment *>(nullptr));
+    }
+
+    static size_t get(const StringView &_value, const StringDeployment *_depl) {
+        if (_depl != nullptr && _depl->stringLengthWidth_ == 0) {
+            return _depl->stringLength_;
+        }
+
+        size_t itsLengthWidth = (_depl ? _depl->stringLengthWidth_ : 4);
+        if (_depl != nullptr && _depl->stringEncoding_ != StringEncoding::UTF8) {
+            // BOM, at most one UTF-16 code unit per UTF-8 byte and termination
+            return itsLengthWidth + 2 + 2 * _value.size() + 2;
+        }
+
+        // BOM, content and termination
+        return itsLengthWidth + 3 + _value.size() + 1;
+    }
+
+    static size_t get(const ByteBuffer &_value, const EmptyDeployment *) {
+        return sizeof(uint32_t) + _value.size();
+    }
+
+    static size_t get(const ByteBuffer &_value, const ByteBufferDeployment *) {
+        return sizeof(uint32_t) + _value.size();
+    }
+
+    static size_t get(const ByteBufferView &_value, const EmptyDeployment *) {
+        return sizeof(uint32_t) + _value.size();
+    }
+
+    static size_t get(const ByteBufferView &_value, const ByteBufferDeployment *) {
+        return sizeof(uint32_t) + _value.size();
+    }
+
+    template<typename Base_>
+    static size_t get(const Enumeration<Base_> &, const EmptyDeployment *) {
+        return sizeof(Base_);
+    }
+
+    template<typename Deployment_, typename Base_>
+    static size_t get(const Enumeration<Base_> &, const Deployment_ *_depl) {
+        if (_depl != nullptr && (_depl->width_ == 1 || _depl->width_ == 2)) {
+            return _depl->width_;
+        }
+        return sizeof(Base_);
+    }
+
+    template<typename... Types_>
+    static size_t get(const Struct<Types_...> &_value, const EmptyDeployment *) {
+        return getMembers(_value, typename make_sequence<sizeof...(Types_)>::type());
+    }
+
+    template<typename Deployment_, typename... Types_>
+    static size_t get(const Struct<Types_...> &_value, const Deployment_ *_depl) {
+        return (_depl ? _depl->structLengthWidth_ : 0)
+                + getMembers(_value, _depl, typename make_sequence<sizeof...(Types_)>::type());
+    }
+
+    template<class PolymorphicStruct_, typename Deployment_>
+    static size_t get(const std::shared_ptr<PolymorphicStruct_> &_value, const Deployment_ *) {
+        return (_value ? sizeof(uint32_t) : 0);
+    }
+
+    template<typename... Types_>
+    static size_t get(const Variant<Types_...> &_value, const EmptyDeployment *) {
+        return 2 * sizeof(uint32_t)
+                + getVariantValue<Types_...>(_value, typename make_sequence<sizeof...(Types_)>::type());
+    }
+
+    template<typename Deployment_, typename... Types_>
+    static size_t get(const Variant<Types_...> &_value, const Deployment_ *_depl) {
+        uint8_t unionLengthWidth = (_depl ? _depl->unionLengthWidth_ : 4);
+        uint8_t unionTypeWidth = (_depl ? _depl->unionTypeWidth_ : 4);
+        if (unionLengthWidth == 0) {
+            return unionTypeWidth + _depl->unionMaxLength_;
+        }
+        return unionLengthWidth + unionTypeWidth
+                + getVariantValue<Types_...>(_value, _depl, typename make_sequence<sizeof...(Types_)>::type());
+    }
+
+    template<typename ElementType_>
+    static size_t get(const std::vector<ElementType_> &_value, const EmptyDeployment *) {
+        return sizeof(uint32_t)
+                + getElements(_value, static_cast<const EmptyDeployment *>(nullptr),
+                      std::integral_constant<bool, std::is_arithmetic<ElementType_>::value>());
+    }
+
+    template<typename ElementType_, typename ElementDepl_>
+    static size_t get(const std::vector<ElementType_> &_value, const ArrayDeployment<ElementDepl_> *_depl) {
+        return (_depl ? _depl->arrayLengthWidth_ : 4)
+                + getElements(_value, (_depl ? _depl->elementDepl_ : nullptr),
+                      std::integral_constant<bool, std::is_arithmetic<ElementType_>::value>());
+    }
+
+    template<typename KeyType_, typename ValueType_, typename HasherType_>
+    static size_t get(const std::unordered_map<KeyType_, ValueType_, HasherType_> &_value,
+                      const EmptyDeployment *) {
+        size_t itsSize(sizeof(uint32_t));
+        for (const auto &v : _value) {
+            itsSize += get(v.first) + get(v.second);
+        }
+        return itsSize;
+    }
+
+    template<typename Deployment_, typename KeyType_, typename ValueType_, typename HasherType_>
+    static size_t get(const std::unordered_map<KeyType_, ValueType_, HasherType_> &_value,
+                      const Deployment_ *_depl) {
+        size_t itsSize(sizeof(uint32_t));
+        for (const auto &v : _value) {
+            itsSize += get(v.first, (_depl ? _depl->key_ : nullptr))
+                     + get(v.second, (_depl ? _depl->value_ : nullptr));
+        }
+        return itsSize;
+    }
+
+    /**
+     * Returns a lower bound for the number of bytes a value of the given type
+     * occupies, whatever its deployment is. Zero means that no bound is known.
+     * Used to size containers before deserializing their elements.
+     */
+    template<typename Type_>
+    static size_t getMinimum() {
+        return getMinimumOf(static_cast<const Type_ *>(nullptr));
+    }
+
+private:
+    template<typename Type_>
+    static typename std::enable_if<std::is_arithmetic<Type_>::value, size_t>::type
+    getMinimumOf(const Type_ *) {
+        return sizeof(Type_);
+    }
+
+    static size_t getMinimumOf(const Version *) {
+        return 2 * sizeof(uint32_t);
+    }
+
+    // BOM and termination
+    static size_t getMinimumOf(const std::string *) {
+        return 4;
+    }
+
+    static size_t getMinimumOf(const StringView *) {
+        return 4;
+    }
+
+    static size_t getMinimumOf(const ByteBuffer *) {
+        return sizeof(uint32_t);
+    }
+
+    static size_t getMinimumOf(const ByteBufferView *) {
+        return sizeof(uint32_t);
+    }
+
+    template<typename Base_>
+    static size_t getMinimumOf(const Enumeration<Base_> *) {
+        return 1;
+    }
+
+    template<typename... Types_>
+    static size_t getMinimumOf(const Struct<Types_...> *) {
+        return sum({ size_t(0), getMinimum<Types_>()... });
+    }
+
+    template<class PolymorphicStruct_>
+    static size_t getMinimumOf(const std::shared_ptr<PolymorphicStruct_> *) {
+        return sizeof(uint32_t);
+    }
+
+    template<typename... Types_>
+    static size_t getMinimumOf(const Variant<Types_...> *) {
+        return 1;
+    }
+
+    template<typename KeyType_, typename ValueType_, typename HasherType_>
+    static size_t getMinimumOf(const std::unordered_map<KeyType_, ValueType_, HasherType_> *) {
+        return sizeof(uint32_t);
+    }
+
+    // arrays may be empty
+    static size_t getMinimumOf(...) {
+        return 0;
+    }
+
+    static size_t sum(std::initializer_list<size_t> _sizes) {
+        size_t itsSum(0);
+        for (auto s : _sizes) {
+            itsSum += s;
+        }
+        return itsSum;
+    }
+
+    template<typename... Types_, int... Indices_>
+    static size_t getMembers(const Struct<Types_...> &_value, index_sequence<Indices_...>) {
+        (void)_value;
+        return sum({ size_t(0), get(std::get<Indices_>(_value.values_))... });
+    }
+
+    template<typename Deployment_, typename... Types_, int... Indices_>
+    static size_t getMembers(const Struct<Types_...> &_value, const Deployment_ *_depl,
+                             index_sequence<Indices_...>) {
+        (void)_value;
+        (void)_depl;
+        return sum({ size_t(0), get(std::get<Indices_>(_value.values_),
+                                    (_depl ? std::get<Indices_>(_depl->values_) : nullptr))... });
+    }
+
+    template<typename... Types_, typename Variant_, int... Indices_>
+    static size_t getVariantValue(const Variant_ &_value, index_sequence<Indices_...>) {
+        (void)_value;
+        const int itsIndex = _value.getMaxValueType() - _value.getValueType();
+        return sum({ size_t(0), (Indices_ == itsIndex ?
+                        get(_value.template get<Types_>()) : 0)... });
+    }
+
+    template<typename... Types_, typename Variant_, typename Deployment_, int... Indices_>
+    static size_t getVariantValue(const Variant_ &_value, const Deployment_ *_depl,
+                                  index_sequence<Indices_...>) {
+        (void)_value;
+        (void)_depl;
+        const int itsIndex = _value.getMaxValueType() - _value.getValueType();
+        return sum({ size_t(0), (Indices_ == itsIndex ?
+                        get(_value.template get<Types_>(),
+                            (_depl ? std::get<Indices_>(_depl->values_) : nullptr)) : 0)... });
+    }
+
+    template<typename ElementType_, typename ElementDepl_>
+    static size_t getElements(const std::vector<ElementType_> &_value, const ElementDepl_ *_depl,
+                              std::false_type) {
+        size_t itsSize(0);
+        for (const auto &e : _value) {
+            itsSize += get(e, _depl);
+        }
+        return itsSize;
+    }
+
+    template<typename ElementType_, typename ElementDepl_>
+    static size_t getElements(const std::vector<ElementType_> &_value, const ElementDepl_ *,
+                              std::true_type) {
+        return _value.size() * sizeof(ElementType_);
+    }
+};
+
+template <typename... Arguments_>
+struct SerializedSize;
+
+template <>
+struct SerializedSize<> {
+    static inline size_t get() {
+        return 0;
+    }
+};
+
+template <typename ArgumentType_, typename... Rest_>
+struct SerializedSize<ArgumentType_, Rest_...> {
+    static inline size_t get(const ArgumentType_ &_argument, const Rest_ &... _rest) {
+        return SerializedValueSize::get(_argument) + SerializedSize<Rest_...>::get(_rest...);
+    }
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_SERIALIZED_SIZE_HPP_
@@ -0,0 +1,81 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_SERIALIZED_VALUE_CACHE_HPP_
+#define COMMONAPI_SOMEIP_SERIALIZED_VALUE_CACHE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include <vsomeip/application.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class SerializedValueCache
+ *
+ * Keeps the serialized value of an attribute, so that get replies and
+ * change notifications can share one payload instead of serializing the
+ * value for each of them.
+ *
+ * Every change of the value increments a version. A payload that was
+ * serialized from a value read before a change is not cached.
+ */
+class SerializedValueCache {
+public:
+    SerializedValueCache()
+        : version_(0) {
+    }
+
+    SerializedValueCache(const SerializedValueCache &) = delete;
+    SerializedValueCache &operator=(const SerializedValueCache &) = delete;
+
+    /**
+     * Returns the cached payload, if any, and the current version that must
+     * be passed to #put when the payload had to be serialized.
+     */
+    std::shared_ptr<vsomeip::payload> get(uint64_t &_version) const {
+        std::lock_guard<std::mutex> itsLock(mutex_);
+        _version = version_;
+        return payload_;
+    }
+
+    void put(const std::shared_ptr<vsomeip::payload> &_payload, uint64_t _version) {
+        std::lock_guard<std::mutex> itsLock(mutex_);
+        if (_version == version_) {
+            payload_ = _payload;
+        }
+    }
+
+    // The value has changed, its serialization is not known
+    void invalidate() {
+        std::lock_guard<std::mutex> itsLock(mutex_);
+        version_++;
+        payload_.reset();
+    }
+
+    // The value has changed to the one serialized in _payload
+    void update(const std::shared_ptr<vsomeip::payload> &_payload) {
+        std::lock_guard<std::mutex> itsLock(mutex_);
+        version_++;
+        payload_ = _payload;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    uint64_t version_;
+    std::shared_ptr<vsomeip::payload> payload_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_SERIALIZED_VALUE_CACHE_HPP_
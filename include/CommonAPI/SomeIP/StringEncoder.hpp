@@ -42,24 +42,27 @@ public:
 
     bool isUtf8Valid(byte_t *_utf8Str);
 
+    /**
+     * Converts _size bytes of UTF-16 to UTF-8 and writes the result (without
+     * termination) to _target, which must provide room for 3 * _size / 2
+     * bytes. Returns the number of bytes written.
+     */
+    size_t utf16To8(const byte_t *_utf16Str, size_t _size, int _endianess, byte_t *_target, EncodingStatus &_status);
+
+    /**
+     * Converts _size bytes of UTF-8 to UTF-16 and writes the result (without
+     * termination) to _target, which must provide room for 2 * _size bytes.
+     * Returns the number of bytes written.
+     */
+    size_t utf8To16(const byte_t *_utf8Str, size_t _size, int _endianess, byte_t *_target, EncodingStatus &_status);
+
+    bool isUtf8Valid(const byte_t *_utf8Str, size_t _size);
+
 private:
-    bool isNewSequence(byte_t _byte);
-    bool isSurrogate(uint16_t _codePoint);
+    bool isSurrogate(uint32_t _codePoint);
     bool isCodePointValid(uint32_t _codePoint);
-    bool isSequenceTooLong(uint32_t _codePoint, int _size);
-    bool nextUtf8(byte_t **_bytes, EncodingStatus &_status);
-    bool nextUtf16(byte_t **_bytes, int &_index, size_t _length, EncodingStatus &_status);
-
-    uint32_t getByteSequence1(byte_t _byte, EncodingStatus &_status);
-    uint32_t getByteSequence2(byte_t **_bytes, EncodingStatus &_status);
-    uint32_t getByteSequence3(byte_t **_bytes, EncodingStatus &_status);
-    uint32_t getByteSequence4(byte_t **_bytes, EncodingStatus &_status);
-
-    int getSequenceLength(byte_t _byte);
-
-    uint32_t getNextBytes(byte_t **_bytes, EncodingStatus &_status);
 
-    bytes_t push(uint32_t _codePoint, EncodingStatus &_status);
+    uint32_t getNextCodePoint(const byte_t *&_bytes, const byte_t *_end, EncodingStatus &_status);
 };
 
 } // namespace SomeIP
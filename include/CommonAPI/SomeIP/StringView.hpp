@@ -0,0 +1,93 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_STRING_VIEW_HPP_
+#define COMMONAPI_SOMEIP_STRING_VIEW_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <CommonAPI/SomeIP/Message.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class StringView
+ *
+ * Argument type that can be used instead of a std::string. It is serialized
+ * exactly like a std::string, but does not copy its content if possible:
+ * - On receive, a UTF-8 encoded string is not copied. The view points into
+ *   the body of the received #Message and keeps the message alive as long as
+ *   the view (or a copy of it) exists. UTF-16 encoded strings must be
+ *   converted and are therefore owned by the view.
+ * - On send, the view points to memory owned by the caller, which must stay
+ *   valid until the value has been serialized.
+ *
+ * The content is not zero terminated.
+ */
+class StringView {
+public:
+    StringView()
+        : data_(nullptr), size_(0) {
+    }
+
+    StringView(const char *_data, size_t _size)
+        : data_(_data), size_(_size) {
+    }
+
+    explicit StringView(const std::string &_value)
+        : data_(_value.data()), size_(_value.size()) {
+    }
+
+    StringView(const Message &_message, const char *_data, size_t _size)
+        : message_(_message), data_(_data), size_(_size) {
+    }
+
+    static StringView fromString(std::string &&_value) {
+        StringView itsView;
+        itsView.storage_ = std::make_shared<std::string>(std::move(_value));
+        itsView.data_ = itsView.storage_->data();
+        itsView.size_ = itsView.storage_->size();
+        return itsView;
+    }
+
+    const char *data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return (size_ == 0); }
+
+    const char *begin() const { return data_; }
+    const char *end() const { return data_ + size_; }
+
+    std::string toString() const {
+        return std::string(begin(), end());
+    }
+
+    bool operator==(const StringView &_other) const {
+        return (size_ == _other.size_
+                && (size_ == 0 || std::memcmp(data_, _other.data_, size_) == 0));
+    }
+
+    bool operator!=(const StringView &_other) const {
+        return !(*this == _other);
+    }
+
+private:
+    Message message_;
+    std::shared_ptr<std::string> storage_;
+    const char *data_;
+    size_t size_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_STRING_VIEW_HPP_
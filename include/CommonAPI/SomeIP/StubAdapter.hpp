@@ -46,6 +46,10 @@ class StubAdapter: virtual public CommonAPI::StubAdapter, public InterfaceHandle
              const std::set<eventgroup_id_t> &_eventGroups, bool _isField);
      COMMONAPI_EXPORT void unregisterEvent(event_id_t _event);
 
+     // Called with each notification that is sent to all subscribers
+     COMMONAPI_EXPORT virtual void updateCachedValue(event_id_t _event,
+             const Message &_notification) const;
+
      COMMONAPI_EXPORT virtual bool onInterfaceMessage(const Message &message) = 0;
 
 protected:
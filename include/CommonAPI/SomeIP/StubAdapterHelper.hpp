@@ -10,12 +10,15 @@
 #ifndef COMMONAPI_SOMEIP_STUB_ADAPTER_HELPER_HPP_
 #define COMMONAPI_SOMEIP_STUB_ADAPTER_HELPER_HPP_
 
+#include <atomic>
 #include <initializer_list>
 #include <memory>
 #include <tuple>
 #include <unordered_map>
 #include <iostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 
 #include <CommonAPI/Logger.hpp>
@@ -24,7 +27,10 @@
 #include <CommonAPI/SomeIP/Helper.hpp>
 #include <CommonAPI/SomeIP/InputStream.hpp>
 #include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/PackedKeyTable.hpp>
 #include <CommonAPI/SomeIP/SerializableArguments.hpp>
+#include <CommonAPI/SomeIP/SerializedSize.hpp>
+#include <CommonAPI/SomeIP/SerializedValueCache.hpp>
 #include <CommonAPI/SomeIP/StubAdapter.hpp>
 
 namespace CommonAPI {
@@ -59,6 +65,12 @@ class StubAdapterHelper: public virtual StubAdapter {
         virtual bool dispatchMessage(const Message &_message,
                                      const std::shared_ptr<StubClass_> &_stub,
                                      StubAdapterHelper<StubClass_> &_helper) = 0;
+
+        // The cached value of an attribute and the event notifying its changes
+        virtual SerializedValueCache *getCachedValue(event_id_t &_event) {
+            (void)_event;
+            return nullptr;
+        }
     };
 
     // interfaceMemberName, interfaceMemberSignature
@@ -71,7 +83,8 @@ class StubAdapterHelper: public virtual StubAdapter {
                       const std::shared_ptr< StubClass_ > &_stub)
         : StubAdapter(_address, _connection),
           stub_(_stub),
-          remoteEventHandler_(nullptr) {
+          remoteEventHandler_(nullptr),
+          firstMethod_(0) {
     }
 
     virtual ~StubAdapterHelper() {
@@ -84,6 +97,7 @@ class StubAdapterHelper: public virtual StubAdapter {
         std::shared_ptr<StubAdapterType> stubAdapter
             = std::dynamic_pointer_cast<StubAdapterType>(instance);
         remoteEventHandler_ = stub_->initStubAdapter(stubAdapter);
+        initDispatchers();
     }
 
     virtual void deinit() {
@@ -95,14 +109,18 @@ class StubAdapterHelper: public virtual StubAdapter {
         return remoteEventHandler_;
     }
 
+    virtual void updateCachedValue(event_id_t _event, const Message &_notification) const {
+        SerializedValueCache * const *itsCache = cachedValues_.find(_event);
+        if (itsCache) {
+            (*itsCache)->update(_notification.getPayload());
+        }
+    }
+
  protected:
 
     virtual bool onInterfaceMessage(const Message &message) {
-        const method_id_t methodId = message.getMethodId();
-
-        auto findIterator = getStubDispatcherTable().find(methodId);
-        const bool foundInterfaceMemberHandler = (findIterator != getStubDispatcherTable().end());
-        if (!foundInterfaceMemberHandler) {
+        StubDispatcher *stubDispatcher = findDispatcher(message.getMethodId());
+        if (!stubDispatcher) {
             auto error = message.createErrorResponseMessage(return_code_e::E_UNKNOWN_METHOD);
             connection_->sendMessage(error);
             return true;
@@ -110,8 +128,7 @@ class StubAdapterHelper: public virtual StubAdapter {
 
         bool isMessageHandled = false;
         //To prevent the destruction of the stub whilst still handling a message
-        if (stub_ && foundInterfaceMemberHandler) {
-            StubDispatcher *stubDispatcher = static_cast< StubDispatcher * >(findIterator->second);
+        if (stub_) {
             isMessageHandled = stubDispatcher->dispatchMessage(message, stub_, *this);
         }
 
@@ -122,6 +139,70 @@ class StubAdapterHelper: public virtual StubAdapter {
 
     std::shared_ptr<StubClass_> stub_;
     RemoteEventHandlerType *remoteEventHandler_;
+
+ private:
+    // Method identifiers of an interface are usually consecutive and are
+    // looked up by their offset. Otherwise, a hash table is used.
+    void initDispatchers() {
+        const StubDispatcherTable &itsTable = getStubDispatcherTable();
+        denseDispatchers_.clear();
+        sparseDispatchers_ = PackedKeyTable<StubDispatcher *>();
+        if (itsTable.empty()) {
+            return;
+        }
+
+        std::vector<std::pair<uint64_t, SerializedValueCache *>> itsCaches;
+        for (const auto &d : itsTable) {
+            event_id_t itsEvent(0);
+            SerializedValueCache *itsCache
+                = static_cast<StubDispatcher *>(d.second)->getCachedValue(itsEvent);
+            if (itsCache) {
+                itsCaches.push_back(std::make_pair(uint64_t(itsEvent), itsCache));
+            }
+        }
+        cachedValues_ = PackedKeyTable<SerializedValueCache *>(itsCaches);
+
+        method_id_t itsFirst(itsTable.begin()->first), itsLast(itsFirst);
+        for (const auto &d : itsTable) {
+            if (d.first < itsFirst) itsFirst = d.first;
+            if (d.first > itsLast) itsLast = d.first;
+        }
+
+        const std::size_t itsSpan = std::size_t(itsLast) - std::size_t(itsFirst) + 1;
+        if (itsSpan <= 4 * itsTable.size() + 16) {
+            firstMethod_ = itsFirst;
+            denseDispatchers_.assign(itsSpan, nullptr);
+            for (const auto &d : itsTable) {
+                denseDispatchers_[std::size_t(d.first) - std::size_t(itsFirst)]
+                    = static_cast<StubDispatcher *>(d.second);
+            }
+        } else {
+            std::vector<std::pair<uint64_t, StubDispatcher *>> itsEntries;
+            for (const auto &d : itsTable) {
+                itsEntries.push_back(std::make_pair(uint64_t(d.first),
+                                                    static_cast<StubDispatcher *>(d.second)));
+            }
+            sparseDispatchers_ = PackedKeyTable<StubDispatcher *>(itsEntries);
+        }
+    }
+
+    inline StubDispatcher *findDispatcher(method_id_t _method) const {
+        if (!denseDispatchers_.empty()) {
+            // Identifiers below the first one wrap around and are rejected
+            const std::size_t itsIndex = std::size_t(_method) - std::size_t(firstMethod_);
+            return (itsIndex < denseDispatchers_.size() ? denseDispatchers_[itsIndex] : nullptr);
+        }
+
+        StubDispatcher * const *itsDispatcher = sparseDispatchers_.find(_method);
+        return (itsDispatcher ? *itsDispatcher : nullptr);
+    }
+
+    method_id_t firstMethod_;
+    std::vector<StubDispatcher *> denseDispatchers_;
+    PackedKeyTable<StubDispatcher *> sparseDispatchers_;
+
+    // Cached attribute values by the event that notifies their changes
+    PackedKeyTable<SerializedValueCache *> cachedValues_;
 };
 
 template <class>
@@ -130,14 +211,15 @@ struct StubEventHelper;
 template <template <class ...> class In_, class... InArgs_>
 struct StubEventHelper<In_<InArgs_...>> {
 
-    static inline bool sendEvent(const Address &_address,
-                                 const event_id_t &_event,
-                                 const std::shared_ptr<ProxyConnection> &_connection,
-                                 const InArgs_&... _in) {
+    static inline bool createEvent(Message &_message,
+                                   const Address &_address,
+                                   const event_id_t &_event,
+                                   const InArgs_&... _in) {
 
-        Message message = Message::createNotificationMessage(_address, _event, false);
+        _message = Message::createNotificationMessage(_address, _event, false);
         if (sizeof...(InArgs_) > 0) {
-            OutputStream output(message);
+            OutputStream output(_message);
+            output.reserveMemory(SerializedSize<InArgs_...>::get(_in...));
             if (!SerializableArguments<InArgs_...>::serialize(output, _in...)) {
                 COMMONAPI_ERROR("CommonAPI::SomeIP::StubEventHelper: serialization failed!");
 
@@ -146,6 +228,19 @@ struct StubEventHelper<In_<InArgs_...>> {
             output.flush();
         }
 
+        return true;
+    }
+
+    static inline bool sendEvent(const Address &_address,
+                                 const event_id_t &_event,
+                                 const std::shared_ptr<ProxyConnection> &_connection,
+                                 const InArgs_&... _in) {
+
+        Message message;
+        if (!createEvent(message, _address, _event, _in...)) {
+            return false;
+        }
+
         return _connection->sendEvent(message);
     }
 
@@ -153,10 +248,13 @@ struct StubEventHelper<In_<InArgs_...>> {
     static bool sendEvent(const Stub_ &_stub,
                           const event_id_t &_event,
                           const InArgs_&... _in) {
-        return (sendEvent(_stub.getSomeIpAddress(),
-                          _event,
-                          _stub.getConnection(),
-                          _in...));
+        Message message;
+        if (!createEvent(message, _stub.getSomeIpAddress(), _event, _in...)) {
+            return false;
+        }
+
+        _stub.updateCachedValue(_event, message);
+        return _stub.getConnection()->sendEvent(message);
     }
 
     template <typename Stub_ = StubAdapter>
@@ -164,19 +262,52 @@ struct StubEventHelper<In_<InArgs_...>> {
                           const Stub_ &_stub,
                           const event_id_t &_event,
                           const InArgs_&... _in) {
-        Message message = Message::createNotificationMessage(
-                _stub.getSomeIpAddress(), _event, false);
-
-        if (sizeof...(InArgs_) > 0) {
-            OutputStream output(message);
-            if (!SerializableArguments<InArgs_...>::serialize(output, _in...)) {
-                COMMONAPI_ERROR("CommonAPI::SomeIP::StubEventHelper 2: serialization failed!");
-                return false;
-            }
-            output.flush();
+        Message message;
+        if (!createEvent(message, _stub.getSomeIpAddress(), _event, _in...)) {
+            return false;
         }
+
         return _stub.getConnection()->sendEvent(message, _client);
     }
+
+    /**
+     * Serializes the event once and sends it to each of the given clients.
+     */
+    template <typename Stub_ = StubAdapter>
+    static bool sendEvent(const std::vector<client_id_t> &_clients,
+                          const Stub_ &_stub,
+                          const event_id_t &_event,
+                          const InArgs_&... _in) {
+        if (_clients.empty()) {
+            return true;
+        }
+
+        Message message;
+        if (!createEvent(message, _stub.getSomeIpAddress(), _event, _in...)) {
+            return false;
+        }
+
+        return _stub.getConnection()->sendEvent(message, _clients);
+    }
+
+    /**
+     * Serializes the event and appends it to a batch of events that is
+     * sent by ProxyConnection::sendEvents.
+     */
+    template <typename Stub_ = StubAdapter>
+    static bool appendEvent(std::vector<Message> &_events,
+                            const Stub_ &_stub,
+                            const event_id_t &_event,
+                            const InArgs_&... _in) {
+        Message message;
+        if (!createEvent(message, _stub.getSomeIpAddress(), _event, _in...)) {
+            return false;
+        }
+
+        _stub.updateCachedValue(_event, message);
+        _events.push_back(message);
+        return true;
+    }
 };
 
 template<class, class, class>
@@ -194,9 +325,7 @@ public:
 
     MethodStubDispatcher(
         StubFunctor_ stubFunctor, std::tuple<DeplInArgs_*...> _in)
-        : stubFunctor_(stubFunctor) {
-
-        initialize(typename make_sequence_range<sizeof...(DeplInArgs_), 0>::type(), _in);
+        : stubFunctor_(stubFunctor), in_(_in) {
     }
 
     bool dispatchMessage(const Message &_message,
@@ -208,31 +337,28 @@ public:
     }
 
 private:
-    template <int... DeplInArgIndices_>
-    inline void initialize(index_sequence<DeplInArgIndices_...>, std::tuple<DeplInArgs_*...> &_in) {
-        in_ = std::make_tuple(std::get<DeplInArgIndices_>(_in)...);
-    }
-
     template <int... InArgIndices_>
     inline bool dispatchMessageHelper(const Message &_message,
                                         const std::shared_ptr<StubClass_> &_stub,
                                         StubAdapterHelperType &_adapterHelper,
                                       index_sequence<InArgIndices_...>) {
-        (void)_adapterHelper;
+        // Local, as messages may be dispatched by several threads at once
+        std::tuple<CommonAPI::Deployable<InArgs_, DeplInArgs_>...> in{
+            std::get<InArgIndices_>(in_)... };
 
         if (sizeof...(DeplInArgs_) > 0) {
             InputStream inputStream(_message);
             if (!SerializableArguments<CommonAPI::Deployable<InArgs_, DeplInArgs_>...>::deserialize(
-                    inputStream, std::get<InArgIndices_>(in_)...))
+                    inputStream, std::get<InArgIndices_>(in)...))
                 return false;
         }
 
         std::shared_ptr<ClientId> client
-            = std::make_shared<ClientId>(_message.getClientId());
+            = _adapterHelper.getConnection()->getClientId(_message.getClientId());
 
         (_stub.get()->*stubFunctor_)(
             client,
-            std::move(std::get<InArgIndices_>(in_))...
+            std::move(std::get<InArgIndices_>(in))...
         );
 
            return true;
@@ -240,7 +366,7 @@ private:
 
     StubFunctor_ stubFunctor_;
 
-    std::tuple<CommonAPI::Deployable<InArgs_, DeplInArgs_>...> in_;
+    std::tuple<DeplInArgs_*...> in_;
 };
 
 
@@ -260,73 +386,77 @@ public:
     typedef std::function<void (OutArgs_...)> ReplyType_t;
     typedef void (StubClass_::*StubFunctor_)(std::shared_ptr<CommonAPI::ClientId>, InArgs_..., ReplyType_t);
 
+    /**
+     * Response to a single call. It is owned by the reply function handed
+     * to the stub, and the response is sent at most once.
+     */
+    struct PendingReply {
+        PendingReply(Message _reply, const std::shared_ptr<ProxyConnection> &_connection)
+            : reply_(std::move(_reply)), connection_(_connection), isSent_(false) {
+        }
+
+        Message reply_;
+        std::shared_ptr<ProxyConnection> connection_;
+        std::atomic<bool> isSent_;
+    };
+
     MethodWithReplyStubDispatcher(
         StubFunctor_ stubFunctor, std::tuple<DeplInArgs_*...> _in, std::tuple<DeplOutArgs_*...> _out)
-        : stubFunctor_(stubFunctor), out_(_out) {
-
-        initialize(typename make_sequence_range<sizeof...(DeplInArgs_), 0>::type(), _in);
+        : stubFunctor_(stubFunctor), in_(_in), out_(_out) {
     }
 
     bool dispatchMessage(const Message &_message,
                          const std::shared_ptr<StubClass_> &_stub,
                          StubAdapterHelperType &_adapterHelper) {
-        connection_ = _adapterHelper.getConnection();
         return dispatchMessageHelper(
-                    _message, _stub,
+                    _message, _stub, _adapterHelper.getConnection(),
                     typename make_sequence_range<sizeof...(InArgs_), 0>::type(),
                     typename make_sequence_range<sizeof...(OutArgs_), 0>::type());
     }
 
-    bool sendReplyMessage(CommonAPI::CallId_t _call,
+    bool sendReplyMessage(const std::shared_ptr<PendingReply> &_reply,
                           std::tuple<CommonAPI::Deployable<OutArgs_, DeplOutArgs_>...> _args = std::make_tuple()) {
-        return sendReplyMessageHelper(_call, typename make_sequence_range<sizeof...(OutArgs_), 0>::type(), _args);
+        return sendReplyMessageHelper(_reply, typename make_sequence_range<sizeof...(OutArgs_), 0>::type(), _args);
     }
 
 private:
-    template <int... DeplInArgIndices_>
-    inline void initialize(index_sequence<DeplInArgIndices_...>, std::tuple<DeplInArgs_*...> &_in) {
-        in_ = std::make_tuple(std::get<DeplInArgIndices_>(_in)...);
-    }
-
     template <int... InArgIndices_, int... OutArgIndices_>
     inline bool dispatchMessageHelper(const Message &_message,
                                         const std::shared_ptr<StubClass_> &_stub,
+                                      const std::shared_ptr<ProxyConnection> &_connection,
                                       index_sequence<InArgIndices_...>,
                                       index_sequence<OutArgIndices_...>) {
         if (!_message.isRequestType()) {
             auto error = _message.createErrorResponseMessage(return_code_e::E_WRONG_MESSAGE_TYPE);
-            connection_->sendMessage(error);
+            _connection->sendMessage(error);
             return true;
         }
 
+        std::tuple<CommonAPI::Deployable<InArgs_, DeplInArgs_>...> in{
+            std::get<InArgIndices_>(in_)... };
+
         if (sizeof...(DeplInArgs_) > 0) {
             InputStream inputStream(_message);
             if (!SerializableArguments<CommonAPI::Deployable<InArgs_, DeplInArgs_>...>::deserialize(
-                    inputStream, std::get<InArgIndices_>(in_)...))
+                    inputStream, std::get<InArgIndices_>(in)...))
                 return false;
         }
 
         std::shared_ptr<ClientId> client
-            = std::make_shared<ClientId>(_message.getClientId());
-        Message reply = _message.createResponseMessage();
-
-        CommonAPI::CallId_t call;
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            call = currentCall_++;
-            pending_[call] = reply;
-        }
+            = _connection->getClientId(_message.getClientId());
+        std::shared_ptr<PendingReply> reply
+            = std::make_shared<PendingReply>(_message.createResponseMessage(), _connection);
 
         // Call the stub function with the list of deserialized in-Parameters
-        // and a lambda function which holds the call identifier the deployments
+        // and a lambda function which holds the pending reply the deployments
         // for the out-Parameters and extracts them from the deployables before
         // calling the send function.
         (_stub.get()->*stubFunctor_)(
             client,
-            std::move(std::get<InArgIndices_>(in_).getValue())...,
-            [call, this](OutArgs_... _args) {
+            std::move(std::get<InArgIndices_>(in).getValue())...,
+            [reply, this](OutArgs_... _args) {
                 this->sendReplyMessage(
-                    call,
+                    reply,
                     std::make_tuple(
                         CommonAPI::Deployable<OutArgs_, DeplOutArgs_>(
                             _args, std::get<OutArgIndices_>(out_)
@@ -340,41 +470,32 @@ private:
     }
 
     template<int... OutArgIndices_>
-    bool sendReplyMessageHelper(CommonAPI::CallId_t _call,
+    bool sendReplyMessageHelper(const std::shared_ptr<PendingReply> &_reply,
                                    index_sequence<OutArgIndices_...>,
                                 std::tuple<CommonAPI::Deployable<OutArgs_, DeplOutArgs_>...> _args) {
         (void)_args;
 
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto reply = pending_.find(_call);
-        if (reply != pending_.end()) {
-            if (sizeof...(DeplOutArgs_) > 0) {
-                OutputStream output(reply->second);
-                if (!SerializableArguments<CommonAPI::Deployable<OutArgs_, DeplOutArgs_>...>::serialize(
-                        output, std::get<OutArgIndices_>(_args)...)) {
-                    pending_.erase(_call);
-                    return false;
-                }
-                output.flush();
-            }
-        } else {
+        if (_reply->isSent_.exchange(true)) {
             return false;
         }
-        bool isSuccessful = connection_->sendMessage(reply->second);
-        pending_.erase(_call);
-        return isSuccessful;
+
+        if (sizeof...(DeplOutArgs_) > 0) {
+            OutputStream output(_reply->reply_);
+            output.reserveMemory(SerializedSize<CommonAPI::Deployable<OutArgs_, DeplOutArgs_>...>::get(
+                    std::get<OutArgIndices_>(_args)...));
+            if (!SerializableArguments<CommonAPI::Deployable<OutArgs_, DeplOutArgs_>...>::serialize(
+                    output, std::get<OutArgIndices_>(_args)...)) {
+                return false;
+            }
+            output.flush();
+        }
+        return _reply->connection_->sendMessage(_reply->reply_);
     }
 
     StubFunctor_ stubFunctor_;
 
-    std::tuple<CommonAPI::Deployable<InArgs_, DeplInArgs_>...> in_;
+    std::tuple<DeplInArgs_*...> in_;
     std::tuple<DeplOutArgs_*...> out_;
-
-    CommonAPI::CallId_t currentCall_;
-    std::map<CommonAPI::CallId_t, Message> pending_;
-    std::mutex mutex_; // protects pending_
-
-    std::shared_ptr<ProxyConnection> connection_;
 };
 
 template<class, class, class, class>
@@ -431,13 +552,14 @@ public:
         }
 
         std::shared_ptr<ClientId> client
-            = std::make_shared<ClientId>(_message.getClientId());
+            = _adapterHelper.getConnection()->getClientId(_message.getClientId());
 
         (_stub->StubType::getStubAdapter().get()->*stubFunctor_)(client, std::move(std::get<InArgIndices_>(_argTuple))..., std::get<OutArgIndices_>(_argTuple)...);
         Message reply = _message.createResponseMessage();
 
         if (sizeof...(OutArgs_) > 0) {
            OutputStream outputStream(reply);
+            outputStream.reserveMemory(SerializedSize<OutArgs_...>::get(std::get<OutArgIndices_>(_argTuple)...));
             if (!SerializableArguments<OutArgs_...>::serialize(outputStream, std::get<OutArgIndices_>(_argTuple)...))
                 return false;
 
@@ -457,29 +579,63 @@ class GetAttributeStubDispatcher: public StubAdapterHelper<StubClass_>::StubDisp
     typedef StubAdapterHelper<StubClass_> StubAdapterHelperType;
     typedef const AttributeType_& (StubClass_::*GetStubFunctor)(std::shared_ptr<CommonAPI::ClientId>);
 
-    GetAttributeStubDispatcher(GetStubFunctor getStubFunctor, AttributeDepl_ *_depl = nullptr)
-        : getStubFunctor_(getStubFunctor), depl_(_depl) {
+    /**
+     * If _cachedEvent is set, the serialized value is reused for get requests
+     * until the attribute is set remotely or a notification of _cachedEvent
+     * is sent. Must only be set for attributes whose value does not depend
+     * on the client and whose changes are notified by _cachedEvent.
+     */
+    GetAttributeStubDispatcher(GetStubFunctor getStubFunctor, AttributeDepl_ *_depl = nullptr,
+                               event_id_t _cachedEvent = 0)
+        : getStubFunctor_(getStubFunctor), depl_(_depl),
+          cachedEvent_(_cachedEvent),
+          cache_(_cachedEvent != 0 ? new SerializedValueCache() : nullptr) {
     }
 
     bool dispatchMessage(const Message &message, const std::shared_ptr<StubClass_> &stub, StubAdapterHelperType &stubAdapterHelper) {
-        return sendAttributeValueReply(message, stub, stubAdapterHelper);
+        std::shared_ptr<ClientId> clientId
+            = stubAdapterHelper.getConnection()->getClientId(message.getClientId());
+        return sendAttributeValueReply(message, clientId, stub, stubAdapterHelper);
+    }
+
+    SerializedValueCache *getCachedValue(event_id_t &_event) {
+        _event = cachedEvent_;
+        return cache_.get();
     }
 
  protected:
-    inline bool sendAttributeValueReply(const Message &message, const std::shared_ptr<StubClass_>& stub, StubAdapterHelperType& stubAdapterHelper) {
+    inline bool sendAttributeValueReply(const Message &message, const std::shared_ptr<ClientId> &clientId,
+                                        const std::shared_ptr<StubClass_>& stub, StubAdapterHelperType& stubAdapterHelper) {
         Message reply = message.createResponseMessage();
-        OutputStream outputStream(reply);
 
-        std::shared_ptr<ClientId> clientId = std::make_shared<ClientId>(message.getClientId());
+        uint64_t itsVersion(0);
+        std::shared_ptr<vsomeip::payload> itsPayload;
+        if (cache_) {
+            itsPayload = cache_->get(itsVersion);
+        }
 
-        outputStream << CommonAPI::Deployable<AttributeType_, AttributeDepl_>((stub.get()->*getStubFunctor_)(clientId), depl_);
-        outputStream.flush();
+        if (itsPayload) {
+            reply.setPayload(itsPayload);
+        } else {
+            OutputStream outputStream(reply);
+
+            CommonAPI::Deployable<AttributeType_, AttributeDepl_> itsValue((stub.get()->*getStubFunctor_)(clientId), depl_);
+            outputStream.reserveMemory(SerializedValueSize::get(itsValue));
+            outputStream << itsValue;
+            outputStream.flush();
+
+            if (cache_) {
+                cache_->put(reply.getPayload(), itsVersion);
+            }
+        }
 
         return stubAdapterHelper.getConnection()->sendMessage(reply);
     }
 
     GetStubFunctor getStubFunctor_;
     AttributeDepl_ *depl_;
+    event_id_t cachedEvent_;
+    std::unique_ptr<SerializedValueCache> cache_;
 };
 
 
@@ -496,8 +652,9 @@ public:
     SetAttributeStubDispatcher(GetStubFunctor getStubFunctor,
                                OnRemoteSetFunctor onRemoteSetFunctor,
                                OnRemoteChangedFunctor onRemoteChangedFunctor,
-                               AttributeDepl_ *_depl = nullptr)
-        : GetAttributeStubDispatcher<StubClass_, AttributeType_, AttributeDepl_>(getStubFunctor, _depl),
+                               AttributeDepl_ *_depl = nullptr,
+                               event_id_t _cachedEvent = 0)
+        : GetAttributeStubDispatcher<StubClass_, AttributeType_, AttributeDepl_>(getStubFunctor, _depl, _cachedEvent),
           onRemoteSetFunctor_(onRemoteSetFunctor),
           onRemoteChangedFunctor_(onRemoteChangedFunctor) {
     }
@@ -505,7 +662,9 @@ public:
     bool dispatchMessage(const Message &message, const std::shared_ptr<StubClass_> &stub, StubAdapterHelperType &stubAdapterHelper) {
         bool attributeValueChanged;
 
-        if (!setAttributeValue(message, stub, stubAdapterHelper, attributeValueChanged)) {
+        std::shared_ptr<ClientId> clientId
+            = stubAdapterHelper.getConnection()->getClientId(message.getClientId());
+        if (!setAttributeValue(message, clientId, stub, stubAdapterHelper, attributeValueChanged)) {
             return false;
         }
 
@@ -518,6 +677,7 @@ public:
 
  protected:
     inline bool setAttributeValue(const Message &message,
+                                  const std::shared_ptr<ClientId> &clientId,
                                   const std::shared_ptr<StubClass_>& stub,
                                   StubAdapterHelperType& stubAdapterHelper,
                                   bool& attributeValueChanged) {
@@ -528,11 +688,12 @@ public:
             return false;
         }
 
-        std::shared_ptr<ClientId> clientId = std::make_shared<ClientId>(message.getClientId());
-
         attributeValueChanged = (stubAdapterHelper.getRemoteEventHandler()->*onRemoteSetFunctor_)(clientId, std::move(attributeValue.getValue()));
+        if (attributeValueChanged && this->cache_) {
+            this->cache_->invalidate();
+        }
 
-        return this->sendAttributeValueReply(message, stub, stubAdapterHelper);
+        return this->sendAttributeValueReply(message, clientId, stub, stubAdapterHelper);
     }
 
     inline void notifyOnRemoteChanged(StubAdapterHelperType& stubAdapterHelper) {
@@ -564,22 +725,25 @@ class SetObservableAttributeStubDispatcher: public SetAttributeStubDispatcher<St
                                          OnRemoteSetFunctor onRemoteSetFunctor,
                                          OnRemoteChangedFunctor onRemoteChangedFunctor,
                                          FireChangedFunctor fireChangedFunctor,
-                                         AttributeDepl_ *_depl = nullptr)
+                                         AttributeDepl_ *_depl = nullptr,
+                                         event_id_t _cachedEvent = 0)
         : SetAttributeStubDispatcher<StubClass_, AttributeType_, AttributeDepl_>(getStubFunctor,
                                                                  onRemoteSetFunctor,
                                                                  onRemoteChangedFunctor,
-                                                                 _depl),
+                                                                 _depl,
+                                                                 _cachedEvent),
                     fireChangedFunctor_(fireChangedFunctor) {
     }
 
     bool dispatchMessage(const Message &message, const std::shared_ptr<StubClass_> &stub, StubAdapterHelperType &stubAdapterHelper) {
         bool attributeValueChanged;
-        if (!this->setAttributeValue(message, stub, stubAdapterHelper, attributeValueChanged)) {
+        std::shared_ptr<ClientId> clientId
+            = stubAdapterHelper.getConnection()->getClientId(message.getClientId());
+        if (!this->setAttributeValue(message, clientId, stub, stubAdapterHelper, attributeValueChanged)) {
             return false;
         }
 
         if (attributeValueChanged) {
-            std::shared_ptr<ClientId> clientId = std::make_shared<ClientId>(message.getClientId());
             fireAttributeValueChanged(clientId, stubAdapterHelper, stub);
             this->notifyOnRemoteChanged(stubAdapterHelper);
         }
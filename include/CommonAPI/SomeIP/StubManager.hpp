@@ -11,8 +11,11 @@
 #define COMMONAPI_SOMEIP_STUB_MANAGER_HPP_
 
 #include <map>
+#include <mutex>
 
 #include <CommonAPI/SomeIP/Connection.hpp>
+#include <CommonAPI/SomeIP/PackedKeyTable.hpp>
+#include <CommonAPI/SomeIP/ReadCopyUpdate.hpp>
 #include <CommonAPI/SomeIP/StubAdapter.hpp>
 
 namespace CommonAPI {
@@ -29,8 +32,16 @@ class StubManager {
     bool handleMessage(const Message&);
 
  private:
+    void updateStubAdapterTable();
+
     std::weak_ptr<ProxyConnection> connection_;
+
+    std::mutex registeredStubAdaptersMutex_;
     std::map<service_id_t, std::map<instance_id_t, std::shared_ptr<StubAdapter>>> registeredStubAdapters_;
+
+    // Read-only copy of registeredStubAdapters_ used to dispatch requests
+    typedef PackedKeyTable<std::shared_ptr<StubAdapter>> stub_adapter_table_t;
+    ReadCopyUpdate<stub_adapter_table_t> stubAdapterTable_;
 };
 
 } // namespace SomeIP
@@ -0,0 +1,121 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_TIMER_SERVICE_HPP_
+#define COMMONAPI_SOMEIP_TIMER_SERVICE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <CommonAPI/Export.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class TimerService
+ *
+ * Process wide service that runs one-shot timers on a single thread. Timers
+ * are kept in a hashed timing wheel with a resolution of one millisecond:
+ * starting and cancelling a timer takes constant time, and the thread only
+ * wakes up when the next timer is due. A bitmap of the occupied slots lets
+ * the thread skip empty slots when it looks for the next timer.
+ *
+ * Cancelling is lazy: a cancelled timer stays in the wheel until its slot is
+ * visited, but its callback is not called.
+ *
+ * The callbacks are called on the timer thread and must therefore return
+ * quickly.
+ */
+class TimerService {
+public:
+    typedef std::chrono::steady_clock clock_t;
+    typedef clock_t::time_point time_point_t;
+
+    class Timer {
+    public:
+        Timer(std::function<void()> _callback)
+            : callback_(std::move(_callback)), tick_(0), isCancelled_(false) {
+        }
+
+        void cancel() {
+            isCancelled_.store(true, std::memory_order_release);
+        }
+
+        bool isCancelled() const {
+            return isCancelled_.load(std::memory_order_acquire);
+        }
+
+    private:
+        friend class TimerService;
+
+        std::function<void()> callback_;
+        uint64_t tick_;
+        std::atomic<bool> isCancelled_;
+    };
+
+    COMMONAPI_EXPORT static std::shared_ptr<TimerService> get();
+
+    COMMONAPI_EXPORT TimerService();
+    COMMONAPI_EXPORT ~TimerService();
+
+    TimerService(const TimerService &) = delete;
+    TimerService &operator=(const TimerService &) = delete;
+
+    /**
+     * Starts a timer that calls its callback once the given point in time
+     * has passed. A timer must not be started more than once.
+     */
+    COMMONAPI_EXPORT void start(const std::shared_ptr<Timer> &_timer, const time_point_t &_expiry);
+
+private:
+    static const uint64_t WHEEL_SIZE = 1024;
+    static const uint64_t NO_TICK = UINT64_MAX;
+
+    uint64_t getTick(const time_point_t &_time) const;
+    void run();
+    void expire(uint64_t _now, uint64_t _index,
+                std::vector<std::shared_ptr<Timer>> &_expired);
+    uint64_t findNextTick();
+
+    bool isOccupied(uint64_t _index) const {
+        return (occupied_[_index / 64] & (uint64_t(1) << (_index % 64))) != 0;
+    }
+    void setOccupied(uint64_t _index) {
+        occupied_[_index / 64] |= (uint64_t(1) << (_index % 64));
+    }
+    void clearOccupied(uint64_t _index) {
+        occupied_[_index / 64] &= ~(uint64_t(1) << (_index % 64));
+    }
+
+    const time_point_t origin_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<std::shared_ptr<Timer>> wheel_[WHEEL_SIZE];
+    uint64_t occupied_[WHEEL_SIZE / 64];
+    size_t count_;
+    uint64_t currentTick_;
+    uint64_t wakeUpTick_;
+
+    std::thread thread_;
+    bool isStopped_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_TIMER_SERVICE_HPP_
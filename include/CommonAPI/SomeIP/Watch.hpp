@@ -10,13 +10,15 @@
 #ifndef WATCH_HPP_
 #define WATCH_HPP_
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
-#include <queue>
-#include <mutex>
+#include <vector>
 
 #include <vsomeip/application.hpp>
 
 #include <CommonAPI/MainLoopContext.hpp>
+#include <CommonAPI/SomeIP/MpscQueue.hpp>
 
 namespace CommonAPI {
 namespace SomeIP {
@@ -49,29 +51,45 @@ class Watch : public CommonAPI::Watch {
 
     void removeDependentDispatchSource(CommonAPI::DispatchSource* _dispatchSource);
 
+    /**
+     * Appends an entry to the queue. The associated file descriptor only
+     * becomes readable when the queue was empty before. Never blocks, may be
+     * called by any thread.
+     */
     void pushQueue(msgQueueEntry _msgQueueEntry);
 
-    void popQueue();
-
-    msgQueueEntry& frontQueue();
+    /**
+     * Moves up to _maxEntries entries from the queue to _entries. Returns
+     * true if the queue still contains entries afterwards. Must only be
+     * called by the main loop, as well as #emptyQueue.
+     */
+    bool popQueue(std::vector<msgQueueEntry> &_entries, std::size_t _maxEntries);
 
     bool emptyQueue();
 
     void processMsgQueueEntry(msgQueueEntry &_msgQueueEntry);
 
 private:
+    void signal();
+    void clearSignal();
+
+#ifdef WIN32
     int pipeFileDescriptors_[2];
+#else
+    int eventFileDescriptor_;
+#endif
 
     pollfd pollFileDescriptor_;
     std::vector<CommonAPI::DispatchSource*> dependentDispatchSources_;
-    std::queue<msgQueueEntry> msgQueue_;
+    MpscQueue<msgQueueEntry> msgQueue_;
 
-    std::mutex msgQueueMutex_;
+    // Set while the associated file descriptor is readable
+    std::atomic<bool> isSignalled_;
 
     std::shared_ptr<Connection> connection_;
 
-    const int pipeValue_;
 #ifdef WIN32
+    static const int pipeValue_ = 4;
     HANDLE wsaEvent_;
     OVERLAPPED ov;
 #endif
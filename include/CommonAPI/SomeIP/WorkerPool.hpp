@@ -0,0 +1,64 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if !defined (COMMONAPI_INTERNAL_COMPILATION)
+#error "Only <CommonAPI/CommonAPI.hpp> can be included directly, this file may disappear or change contents."
+#endif
+
+#ifndef COMMONAPI_SOMEIP_WORKER_POOL_HPP_
+#define COMMONAPI_SOMEIP_WORKER_POOL_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <CommonAPI/Export.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+/**
+ * @class WorkerPool
+ *
+ * Fixed number of threads that execute posted tasks. Each task is posted
+ * with a key, and all tasks with the same key are executed by the same
+ * thread in the order they were posted. Tasks with different keys may run
+ * in parallel.
+ */
+class WorkerPool {
+public:
+    COMMONAPI_EXPORT WorkerPool(std::size_t _threads);
+    COMMONAPI_EXPORT ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    COMMONAPI_EXPORT void post(uint64_t _key, std::function<void()> _task);
+
+private:
+    struct Worker {
+        Worker() : isStopped_(false) {}
+
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        std::deque<std::function<void()>> tasks_;
+        bool isStopped_;
+        std::thread thread_;
+    };
+
+    void run(Worker &_worker);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+} // namespace SomeIP
+} // namespace CommonAPI
+
+#endif // COMMONAPI_SOMEIP_WORKER_POOL_HPP_
@@ -3,14 +3,6 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
-#ifdef WIN32
-#include <Windows.h>
-#else
-#include <unistd.h>
-#endif
-
-#include <sys/stat.h>
-
 #include <algorithm>
 #include <sstream>
 
@@ -18,13 +10,11 @@
 #include <CommonAPI/Logger.hpp>
 #include <CommonAPI/SomeIP/AddressTranslator.hpp>
 #include <CommonAPI/SomeIP/Config.hpp>
+#include <CommonAPI/SomeIP/Configuration.hpp>
 
 namespace CommonAPI {
 namespace SomeIP {
 
-const char *COMMONAPI_SOMEIP_DEFAULT_CONFIG_FILE = "commonapi-someip.ini";
-const char *COMMONAPI_SOMEIP_DEFAULT_CONFIG_FOLDER = "/etc/";
-
 std::shared_ptr<AddressTranslator> AddressTranslator::get() {
     static std::shared_ptr<AddressTranslator> theTranslator
         = std::make_shared<AddressTranslator>();
@@ -37,16 +27,6 @@ AddressTranslator::AddressTranslator() {
 
 void
 AddressTranslator::init() {
-    // Determine default configuration file
-    const char *config = getenv("COMMONAPI_SOMEIP_CONFIG");
-    if (config) {
-        defaultConfig_ = config;
-    } else {
-        defaultConfig_ = COMMONAPI_SOMEIP_DEFAULT_CONFIG_FOLDER;
-        defaultConfig_ += "/";
-        defaultConfig_ += COMMONAPI_SOMEIP_DEFAULT_CONFIG_FILE;
-    }
-
     (void)readConfiguration();
 }
 
@@ -128,31 +108,17 @@ AddressTranslator::insert(
 
 bool
 AddressTranslator::readConfiguration() {
-#define MAX_PATH_LEN 255
-    std::string config;
-    char currentDirectory[MAX_PATH_LEN];
-#ifdef WIN32
-    if (GetCurrentDirectory(MAX_PATH_LEN, currentDirectory)) {
-#else
-    if (getcwd(currentDirectory, MAX_PATH_LEN)) {
-#endif
-        config = currentDirectory;
-        config += "/";
-        config += COMMONAPI_SOMEIP_DEFAULT_CONFIG_FILE;
-
-        struct stat s;
-        if (stat(config.c_str(), &s) != 0) {
-            config = defaultConfig_;
-        }
-    }
-
-    IniFileReader reader;
-    if (!reader.load(config))
+    std::shared_ptr<const IniFileReader> reader = Configuration::getConfigurationFile();
+    if (!reader)
         return false;
 
-    for (auto itsMapping : reader.getSections()) {
+    for (auto itsMapping : reader->getSections()) {
         service_id_t service;
         std::string serviceEntry = itsMapping.second->getValue("service");
+        if (serviceEntry == "") {
+            // Not an address mapping, but a setting (see Configuration)
+            continue;
+        }
 
         std::stringstream converter;
         if (0 == serviceEntry.find("0x")) {
@@ -0,0 +1,115 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <utility>
+
+#include <CommonAPI/SomeIP/AdmissionControl.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+AdmissionControl::AdmissionControl(
+        const Configuration::service_limits_t &_serviceLimits,
+        const Configuration::method_limits_t &_methodLimits) {
+    std::vector<std::pair<uint64_t, Counter *>> itsServices;
+    for (const auto &l : _serviceLimits) {
+        counters_.push_back(std::unique_ptr<Counter>(new Counter(l.second)));
+        itsServices.push_back(std::make_pair(uint64_t(l.first), counters_.back().get()));
+    }
+    services_ = PackedKeyTable<Counter *>(itsServices);
+
+    std::vector<std::pair<uint64_t, Counter *>> itsMethods;
+    for (const auto &l : _methodLimits) {
+        counters_.push_back(std::unique_ptr<Counter>(new Counter(l.second)));
+        itsMethods.push_back(std::make_pair(
+                packKey(l.first.first, l.first.second), counters_.back().get()));
+    }
+    methods_ = PackedKeyTable<Counter *>(itsMethods);
+}
+
+bool AdmissionControl::enqueue(service_id_t _service, method_id_t _method) {
+    Counter *itsService = findService(_service);
+    Counter *itsMethod = findMethod(_service, _method);
+
+    bool isAdmitted = (!itsService
+            || acquire(itsService->queued_, itsService->limits_.maxQueued_));
+    if (isAdmitted && itsMethod
+            && !acquire(itsMethod->queued_, itsMethod->limits_.maxQueued_)) {
+        if (itsService) itsService->queued_--;
+        isAdmitted = false;
+    }
+
+    if (!isAdmitted) {
+        shed(itsService, itsMethod);
+    }
+    return isAdmitted;
+}
+
+bool AdmissionControl::start(service_id_t _service, method_id_t _method) {
+    Counter *itsService = findService(_service);
+    Counter *itsMethod = findMethod(_service, _method);
+    if (itsService) itsService->queued_--;
+    if (itsMethod) itsMethod->queued_--;
+
+    bool isAdmitted = (!itsService
+            || acquire(itsService->inFlight_, itsService->limits_.maxInFlight_));
+    if (isAdmitted && itsMethod
+            && !acquire(itsMethod->inFlight_, itsMethod->limits_.maxInFlight_)) {
+        if (itsService) itsService->inFlight_--;
+        isAdmitted = false;
+    }
+
+    if (!isAdmitted) {
+        shed(itsService, itsMethod);
+    }
+    return isAdmitted;
+}
+
+void AdmissionControl::finish(service_id_t _service, method_id_t _method) {
+    Counter *itsService = findService(_service);
+    if (itsService) itsService->inFlight_--;
+
+    Counter *itsMethod = findMethod(_service, _method);
+    if (itsMethod) itsMethod->inFlight_--;
+}
+
+uint64_t AdmissionControl::getShedCount(service_id_t _service) const {
+    Counter *itsService = findService(_service);
+    return (itsService ? itsService->shed_.load() : 0);
+}
+
+uint64_t AdmissionControl::getShedCount(service_id_t _service, method_id_t _method) const {
+    Counter *itsMethod = findMethod(_service, _method);
+    return (itsMethod ? itsMethod->shed_.load() : 0);
+}
+
+bool AdmissionControl::acquire(std::atomic<std::size_t> &_count, std::size_t _limit) {
+    std::size_t itsCount = _count++;
+    if (_limit > 0 && itsCount >= _limit) {
+        _count--;
+        return false;
+    }
+    return true;
+}
+
+void AdmissionControl::shed(Counter *_service, Counter *_method) {
+    if (_service) _service->shed_++;
+    if (_method) _method->shed_++;
+}
+
+AdmissionControl::Counter *
+AdmissionControl::findService(service_id_t _service) const {
+    Counter * const *itsCounter = services_.find(_service);
+    return (itsCounter ? *itsCounter : nullptr);
+}
+
+AdmissionControl::Counter *
+AdmissionControl::findMethod(service_id_t _service, method_id_t _method) const {
+    Counter * const *itsCounter = methods_.find(packKey(_service, _method));
+    return (itsCounter ? *itsCounter : nullptr);
+}
+
+} // namespace SomeIP
+} // namespace CommonAPI
@@ -0,0 +1,116 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if defined(LINUX)
+#include <endian.h>
+#elif defined(FREEBSD)
+#include <sys/endian.h>
+#endif
+
+#include <cstring>
+
+#include <CommonAPI/SomeIP/ByteOrder.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define COMMONAPI_SOMEIP_HAS_SHUFFLE_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace CommonAPI {
+namespace SomeIP {
+
+namespace {
+
+void copySwappedScalar(byte_t *_target, const byte_t *_source,
+                       size_t _count, size_t _width) {
+    for (size_t i = 0; i < _count; ++i) {
+        const byte_t *source = _source + (i + 1) * _width - 1;
+        for (size_t j = 0; j < _width; ++j) {
+            *_target++ = *source--;
+        }
+    }
+}
+
+#ifdef COMMONAPI_SOMEIP_HAS_SHUFFLE_KERNELS
+// Shuffle mask that reverses the byte order of each _width bytes wide
+// element within a 16 byte lane. As all supported widths divide 16, the
+// same mask is valid for every lane.
+void getShuffleMask(byte_t *_mask, size_t _width) {
+    for (size_t i = 0; i < 16; ++i) {
+        _mask[i] = byte_t((i / _width) * _width + (_width - 1 - i % _width));
+    }
+}
+
+__attribute__((target("ssse3")))
+void copySwappedSsse3(byte_t *_target, const byte_t *_source,
+                      size_t _count, size_t _width) {
+    byte_t mask[16];
+    getShuffleMask(mask, _width);
+    const __m128i itsMask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask));
+
+    size_t itsBlocks = (_count * _width) / 16;
+    for (size_t i = 0; i < itsBlocks; ++i) {
+        __m128i itsBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_source));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(_target),
+                         _mm_shuffle_epi8(itsBlock, itsMask));
+        _source += 16;
+        _target += 16;
+    }
+
+    copySwappedScalar(_target, _source, _count - (itsBlocks * 16) / _width, _width);
+}
+
+__attribute__((target("avx2")))
+void copySwappedAvx2(byte_t *_target, const byte_t *_source,
+                     size_t _count, size_t _width) {
+    byte_t mask[16];
+    getShuffleMask(mask, _width);
+    const __m256i itsMask = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask)));
+
+    size_t itsBlocks = (_count * _width) / 32;
+    for (size_t i = 0; i < itsBlocks; ++i) {
+        __m256i itsBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_source));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(_target),
+                            _mm256_shuffle_epi8(itsBlock, itsMask));
+        _source += 32;
+        _target += 32;
+    }
+
+    copySwappedScalar(_target, _source, _count - (itsBlocks * 32) / _width, _width);
+}
+#endif
+
+typedef void (*copy_swapped_t)(byte_t *, const byte_t *, size_t, size_t);
+
+copy_swapped_t selectCopySwapped() {
+#ifdef COMMONAPI_SOMEIP_HAS_SHUFFLE_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return copySwappedAvx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return copySwappedSsse3;
+#endif
+    return copySwappedScalar;
+}
+
+} // namespace
+
+void copyByteOrdered(byte_t *_target, const byte_t *_source,
+                     size_t _count, size_t _width) {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+    if (_width > 1) {
+        static const copy_swapped_t copySwapped = selectCopySwapped();
+        copySwapped(_target, _source, _count, _width);
+        return;
+    }
+#endif
+    if (_count > 0) {
+        std::memcpy(_target, _source, _count * _width);
+    }
+}
+
+} // namespace SomeIP
+} // namespace CommonAPI
@@ -0,0 +1,65 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+
+#include <CommonAPI/SomeIP/ClientIdTable.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+const std::size_t COMMONAPI_SOMEIP_MIN_CLIENT_ID_PRUNE_SIZE = 64;
+
+ClientIdTable::ClientIdTable()
+    : pruneSize_(COMMONAPI_SOMEIP_MIN_CLIENT_ID_PRUNE_SIZE) {
+}
+
+std::shared_ptr<ClientId>
+ClientIdTable::get(client_id_t _client) {
+    {
+        auto itsTable = table_.read();
+        const std::shared_ptr<ClientId> *itsClientId = itsTable->find(_client);
+        if (itsClientId) {
+            return *itsClientId;
+        }
+    }
+
+    std::lock_guard<std::mutex> itsLock(mutex_);
+    {
+        // Might have been added meanwhile
+        auto itsTable = table_.read();
+        const std::shared_ptr<ClientId> *itsClientId = itsTable->find(_client);
+        if (itsClientId) {
+            return *itsClientId;
+        }
+    }
+
+    if (clientIds_.size() >= pruneSize_) {
+        prune();
+    }
+
+    std::shared_ptr<ClientId> itsClientId = std::make_shared<ClientId>(_client);
+    clientIds_.push_back(std::make_pair(uint64_t(_client), itsClientId));
+    table_.update(std::unique_ptr<client_id_table_t>(
+            new client_id_table_t(clientIds_)));
+    return itsClientId;
+}
+
+void
+ClientIdTable::prune() {
+    // An object that is only referenced by clientIds_ and the current
+    // table is not used by any request or stub anymore.
+    clientIds_.erase(
+        std::remove_if(clientIds_.begin(), clientIds_.end(),
+            [](const std::pair<uint64_t, std::shared_ptr<ClientId>> &_entry) {
+                return (_entry.second.use_count() <= 2);
+            }),
+        clientIds_.end());
+
+    pruneSize_ = std::max(2 * clientIds_.size(), COMMONAPI_SOMEIP_MIN_CLIENT_ID_PRUNE_SIZE);
+}
+
+} // namespace SomeIP
+} // namespace CommonAPI
@@ -0,0 +1,230 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifdef WIN32
+#include <Windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <CommonAPI/IniFileReader.hpp>
+#include <CommonAPI/Logger.hpp>
+#include <CommonAPI/SomeIP/Configuration.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+const char *COMMONAPI_SOMEIP_DEFAULT_CONFIG_FILE = "commonapi-someip.ini";
+const char *COMMONAPI_SOMEIP_DEFAULT_CONFIG_FOLDER = "/etc/";
+
+const char *COMMONAPI_SOMEIP_DISPATCH_SECTION = "dispatch";
+const char *COMMONAPI_SOMEIP_ADMISSION_SECTION = "admission";
+const std::size_t COMMONAPI_SOMEIP_DEFAULT_MAINLOOP_BUDGET = 16;
+const std::size_t COMMONAPI_SOMEIP_MAX_STUB_THREADS_PER_CORE = 4;
+
+std::shared_ptr<Configuration> Configuration::get() {
+    static std::shared_ptr<Configuration> theConfiguration
+        = std::make_shared<Configuration>();
+    return theConfiguration;
+}
+
+Configuration::Configuration()
+    : stubDispatchThreads_(0),
+      stubDispatchOrder_(StubDispatchOrder::SERVICE),
+      mainLoopDispatchBudget_(COMMONAPI_SOMEIP_DEFAULT_MAINLOOP_BUDGET) {
+    init();
+}
+
+void
+Configuration::init() {
+    (void)readConfiguration();
+}
+
+static std::string findConfigurationFile() {
+    // Determine default configuration file
+    std::string defaultConfig;
+    const char *config = getenv("COMMONAPI_SOMEIP_CONFIG");
+    if (config) {
+        defaultConfig = config;
+    } else {
+        defaultConfig = COMMONAPI_SOMEIP_DEFAULT_CONFIG_FOLDER;
+        defaultConfig += "/";
+        defaultConfig += COMMONAPI_SOMEIP_DEFAULT_CONFIG_FILE;
+    }
+
+#define MAX_PATH_LEN 255
+    std::string itsConfig(defaultConfig);
+    char currentDirectory[MAX_PATH_LEN];
+#ifdef WIN32
+    if (GetCurrentDirectory(MAX_PATH_LEN, currentDirectory)) {
+#else
+    if (getcwd(currentDirectory, MAX_PATH_LEN)) {
+#endif
+        itsConfig = currentDirectory;
+        itsConfig += "/";
+        itsConfig += COMMONAPI_SOMEIP_DEFAULT_CONFIG_FILE;
+
+        struct stat s;
+        if (stat(itsConfig.c_str(), &s) != 0) {
+            itsConfig = defaultConfig;
+        }
+    }
+    return itsConfig;
+}
+
+static std::shared_ptr<const IniFileReader> loadConfigurationFile() {
+    std::shared_ptr<IniFileReader> itsReader = std::make_shared<IniFileReader>();
+    if (!itsReader->load(findConfigurationFile()))
+        return nullptr;
+    return itsReader;
+}
+
+std::shared_ptr<const IniFileReader>
+Configuration::getConfigurationFile() {
+    static std::shared_ptr<const IniFileReader> theConfigurationFile
+        = loadConfigurationFile();
+    return theConfigurationFile;
+}
+
+std::size_t
+Configuration::getStubDispatchThreads() const {
+    return stubDispatchThreads_;
+}
+
+StubDispatchOrder
+Configuration::getStubDispatchOrder() const {
+    return stubDispatchOrder_;
+}
+
+std::size_t
+Configuration::getMainLoopDispatchBudget() const {
+    return mainLoopDispatchBudget_;
+}
+
+const Configuration::service_limits_t &
+Configuration::getServiceAdmissionLimits() const {
+    return serviceAdmissionLimits_;
+}
+
+const Configuration::method_limits_t &
+Configuration::getMethodAdmissionLimits() const {
+    return methodAdmissionLimits_;
+}
+
+bool
+Configuration::readConfiguration() {
+    std::shared_ptr<const IniFileReader> reader = getConfigurationFile();
+    if (!reader)
+        return false;
+
+    std::shared_ptr<IniFileReader::Section> itsAdmission
+        = reader->getSection(COMMONAPI_SOMEIP_ADMISSION_SECTION);
+    if (itsAdmission) {
+        for (auto itsLimit : itsAdmission->getMappings()) {
+            readAdmissionLimits(itsLimit.first, itsLimit.second);
+        }
+    }
+
+    std::shared_ptr<IniFileReader::Section> itsDispatch
+        = reader->getSection(COMMONAPI_SOMEIP_DISPATCH_SECTION);
+    if (!itsDispatch)
+        return true;
+
+    std::string threadsEntry = itsDispatch->getValue("stub-threads");
+    if (threadsEntry != "") {
+        // Negative numbers are converted to huge unsigned ones
+        std::size_t itsMaxThreads = COMMONAPI_SOMEIP_MAX_STUB_THREADS_PER_CORE
+                * std::max(std::thread::hardware_concurrency(), 1u);
+        std::stringstream converter;
+        converter << std::dec << threadsEntry;
+        converter >> stubDispatchThreads_;
+        if (converter.fail() || threadsEntry.find('-') != std::string::npos
+                || stubDispatchThreads_ > itsMaxThreads) {
+            COMMONAPI_ERROR("Invalid number of stub dispatch threads \"",
+                    threadsEntry, "\"");
+            stubDispatchThreads_ = 0;
+        }
+    }
+
+    std::string orderEntry = itsDispatch->getValue("stub-order");
+    if (orderEntry == "client") {
+        stubDispatchOrder_ = StubDispatchOrder::CLIENT;
+    } else if (orderEntry != "" && orderEntry != "service") {
+        COMMONAPI_ERROR("Invalid stub dispatch order \"", orderEntry, "\"");
+    }
+
+    std::string budgetEntry = itsDispatch->getValue("mainloop-budget");
+    if (budgetEntry != "") {
+        std::stringstream converter;
+        converter << std::dec << budgetEntry;
+        converter >> mainLoopDispatchBudget_;
+        if (converter.fail() || mainLoopDispatchBudget_ == 0) {
+            COMMONAPI_ERROR("Invalid main loop dispatch budget \"",
+                    budgetEntry, "\"");
+            mainLoopDispatchBudget_ = COMMONAPI_SOMEIP_DEFAULT_MAINLOOP_BUDGET;
+        }
+    }
+
+    return true;
+}
+
+void
+Configuration::readAdmissionLimits(const std::string &_key, const std::string &_value) {
+    // <service>[.<method>].max-queued|max-in-flight
+    std::vector<std::string> itsParts;
+    std::stringstream splitter(_key);
+    std::string itsPart;
+    while (std::getline(splitter, itsPart, '.')) {
+        itsParts.push_back(itsPart);
+    }
+
+    std::vector<uint16_t> itsIds;
+    for (size_t i = 0; i + 1 < itsParts.size(); i++) {
+        uint16_t itsId(0);
+        std::stringstream converter;
+        if (0 == itsParts[i].find("0x")) {
+            converter << std::hex << itsParts[i].substr(2);
+        } else {
+            converter << std::dec << itsParts[i];
+        }
+        converter >> itsId;
+        if (converter.fail()) {
+            break;
+        }
+        itsIds.push_back(itsId);
+    }
+
+    std::size_t itsLimit(0);
+    std::stringstream converter;
+    converter << std::dec << _value;
+    converter >> itsLimit;
+
+    if (itsParts.size() < 2 || itsParts.size() > 3
+            || itsIds.size() != itsParts.size() - 1
+            || (itsParts.back() != "max-queued" && itsParts.back() != "max-in-flight")
+            || converter.fail()) {
+        COMMONAPI_ERROR("Invalid admission limit \"", _key, "=", _value, "\"");
+        return;
+    }
+
+    AdmissionLimits &itsLimits = (itsIds.size() == 1 ?
+            serviceAdmissionLimits_[itsIds[0]] :
+            methodAdmissionLimits_[std::make_pair(itsIds[0], itsIds[1])]);
+    if (itsParts.back() == "max-queued") {
+        itsLimits.maxQueued_ = itsLimit;
+    } else {
+        itsLimits.maxInFlight_ = itsLimit;
+    }
+}
+
+} // namespace SomeIP
+} // namespace CommonAPI
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <iostream>
@@ -15,6 +16,7 @@
 
 #include <CommonAPI/Logger.hpp>
 #include <CommonAPI/SomeIP/Config.hpp>
+#include <CommonAPI/SomeIP/Configuration.hpp>
 #include <CommonAPI/SomeIP/Connection.hpp>
 #include <CommonAPI/SomeIP/Defines.hpp>
 #include <CommonAPI/SomeIP/ProxyAsyncEventCallbackHandler.hpp>
@@ -22,7 +24,42 @@
 namespace CommonAPI {
 namespace SomeIP {
 
-void Connection::proxyReceive(const std::shared_ptr<vsomeip::message> &_message) {
+namespace {
+
+// Wait slot of a caller blocked in sendMessageWithReplyAndBlock
+struct BlockingCall {
+    BlockingCall() : isAnswered_(false) {}
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool isAnswered_;
+    Message answer_;
+};
+
+class BlockingCallHandler : public ProxyConnection::MessageReplyAsyncHandler {
+public:
+    BlockingCallHandler(const std::shared_ptr<BlockingCall> &_call)
+        : call_(_call) {
+    }
+
+    virtual std::future<CallStatus> getFuture() {
+        return std::future<CallStatus>();
+    }
+
+    virtual void onMessageReply(const CallStatus &, const Message &_reply) {
+        std::lock_guard<std::mutex> itsLock(call_->mutex_);
+        call_->answer_ = _reply;
+        call_->isAnswered_ = true;
+        call_->condition_.notify_one();
+    }
+
+private:
+    std::shared_ptr<BlockingCall> call_;
+};
+
+} // namespace
+
+void Connection::proxyReceive(const std::shared_ptr<vsomeip::message> &_message) const {
 
     if (auto lockedContext = mainLoopContext_.lock()) {
         Watch::msgQueueEntry msg_queue_entry(_message, Watch::commDirectionType::PROXYRECEIVE);
@@ -33,74 +70,106 @@ void Connection::proxyReceive(const std::shared_ptr<vsomeip::message> &_message)
     }
 }
 
-void Connection::handleProxyReceive(const std::shared_ptr<vsomeip::message> &_message) {
-    sendReceiveMutex_.lock();
-
-    session_id_t sessionId = _message->get_session();
-
+void Connection::handleProxyReceive(const std::shared_ptr<vsomeip::message> &_message) const {
     // handle events
     if(_message->get_message_type() == message_type_e::MT_NOTIFICATION) {
         service_id_t serviceId = _message->get_service();
         instance_id_t instanceId = _message->get_instance();
         event_id_t eventId = _message->get_method();
 
-        std::set<ProxyConnection::EventHandler *> handlers;
+        // Notifications are dispatched without locking and without
+        // allocating memory unless there are many handlers.
+        const size_t maxInlineHandlers = 8;
+        EventHandlerEntry itsInlineHandlers[maxInlineHandlers];
+        std::vector<EventHandlerEntry> itsHandlers;
+        size_t itsHandlerCount(0);
         {
-            std::unique_lock<std::mutex> eventLock(eventHandlerMutex_);
-            auto foundService = eventHandlers_.find(serviceId);
-            if (foundService != eventHandlers_.end()) {
-                auto foundInstance = foundService->second.find(instanceId);
-                if (foundInstance != foundService->second.end()) {
-                    auto foundEvent = foundInstance->second.find(eventId);
-                    if (foundEvent != foundInstance->second.end()) {
-                        for (auto handler : foundEvent->second)
-                            handlers.insert(handler);
-                    }
+            auto itsTable = eventHandlerTable_.read();
+            auto foundHandlers = itsTable->find(packKey(serviceId, instanceId, eventId));
+            if (foundHandlers) {
+                itsHandlerCount = foundHandlers->size();
+                if (itsHandlerCount <= maxInlineHandlers) {
+                    std::copy(foundHandlers->begin(), foundHandlers->end(), itsInlineHandlers);
+                } else {
+                    itsHandlers = *foundHandlers;
                 }
             }
         }
-        sendReceiveMutex_.unlock();
-
-        // We must not hold the lock when calling the handlers!
-        for (auto handler : handlers)
-            handler->onEventMessage(Message(_message));
-
-        return;
-    }
 
-    // handle sync method calls
-    if(sendAndBlockAnswer_.first == sessionId) {
-        sendReceiveMutex_.unlock();
-        std::lock_guard< std::mutex > its_lock(sendAndBlockMutex_);
-        sendAndBlockAnswer_.second = Message(_message);
-        sendAndBlockWait_ = false;
-        sendAndBlockCondition_.notify_one();
+        // We must not hold the table when calling the handlers!
+        const EventHandlerEntry *itsHandlerArray
+            = (itsHandlerCount <= maxInlineHandlers ? itsInlineHandlers : itsHandlers.data());
+        Message itsMessage(_message);
+        size_t i = 0;
+        while (i < itsHandlerCount) {
+            size_t itsGroupEnd = i + 1;
+            while (itsGroupEnd < itsHandlerCount && itsHandlerArray[itsGroupEnd].sharesDecoding_)
+                itsGroupEnd++;
+
+            if (itsGroupEnd == i + 1) {
+                itsHandlerArray[i].handler_->onEventMessage(itsMessage);
+            } else {
+                // Decode once for all handlers of the group
+                std::shared_ptr<const void> itsDecoded
+                    = itsHandlerArray[i].handler_->decodeEventMessage(itsMessage);
+                if (itsDecoded) {
+                    for (; i < itsGroupEnd; i++)
+                        itsHandlerArray[i].handler_->onDecodedEventMessage(itsDecoded);
+                }
+            }
+            i = itsGroupEnd;
+        }
 
         return;
     }
 
-    // handle async method calls
-    async_answers_map_t::iterator foundAsyncHandler = asyncAnswers_.find(sessionId);
-    if(foundAsyncHandler != asyncAnswers_.end()) {
+    // handle method calls
+    PendingCallTable::Call itsCall;
+    if (pendingCalls_.complete(_message, itsCall)) {
         CallStatus callStatus = (_message->get_return_code() == vsomeip::return_code_e::E_OK ?
                                     CallStatus::SUCCESS : CallStatus::REMOTE_ERROR);
-        std::get<2>(foundAsyncHandler->second)->onMessageReply(callStatus, Message(_message));
-        asyncAnswers_.erase(sessionId);
+        if (itsCall.timer_)
+            itsCall.timer_->cancel();
+        itsCall.handler_->onMessageReply(callStatus, Message(_message));
     }
-    sendReceiveMutex_.unlock();
 }
 
 void Connection::stubReceive(const std::shared_ptr<vsomeip::message> &_message) {
+    if (isAdmissionControlled(_message)
+            && !admission_->enqueue(_message->get_service(), _message->get_method())) {
+        rejectRequest(_message);
+        return;
+    }
+
     if (auto lockedContext = mainLoopContext_.lock()) {
         Watch::msgQueueEntry msg_queue_entry(_message, Watch::commDirectionType::STUBRECEIVE);
         watch_->pushQueue(msg_queue_entry);
     }
+    else if (stubWorkers_) {
+        uint64_t itsKey;
+        if (stubDispatchOrder_ == StubDispatchOrder::CLIENT) {
+            itsKey = _message->get_client();
+        } else {
+            itsKey = packKey(_message->get_service(), _message->get_instance());
+        }
+        std::shared_ptr<vsomeip::message> itsMessage(_message);
+        stubWorkers_->post(itsKey, [this, itsMessage]() {
+            handleStubReceive(itsMessage);
+        });
+    }
     else {
         handleStubReceive(_message);
     }
 }
 
 void Connection::handleStubReceive(const std::shared_ptr<vsomeip::message> &_message) {
+    const bool isControlled = isAdmissionControlled(_message);
+    if (isControlled
+            && !admission_->start(_message->get_service(), _message->get_method())) {
+        rejectRequest(_message);
+        return;
+    }
+
     if(stubMessageHandler_) {
         if (!stubMessageHandler_(Message(_message))) {
             if (_message->get_message_type() == message_type_e::MT_REQUEST) {
@@ -111,6 +180,25 @@ void Connection::handleStubReceive(const std::shared_ptr<vsomeip::message> &_mes
             }
         }
     }
+
+    if (isControlled) {
+        admission_->finish(_message->get_service(), _message->get_method());
+    }
+}
+
+bool Connection::isAdmissionControlled(const std::shared_ptr<vsomeip::message> &_message) const {
+    return (admission_
+            && (_message->get_message_type() == message_type_e::MT_REQUEST
+                || _message->get_message_type() == message_type_e::MT_REQUEST_NO_RETURN));
+}
+
+void Connection::rejectRequest(const std::shared_ptr<vsomeip::message> &_message) const {
+    if (_message->get_message_type() == message_type_e::MT_REQUEST) {
+        auto error = vsomeip::runtime::get()->create_response(_message);
+        error->set_message_type(message_type_e::MT_ERROR);
+        error->set_return_code(return_code_e::E_NOT_READY);
+        application_->send(error, true);
+    }
 }
 
 void Connection::onConnectionEvent(state_type_e state) {
@@ -147,45 +235,27 @@ void Connection::dispatch() {
     application_->start();
 }
 
-void Connection::cleanup() {
-    std::unique_lock<std::mutex> itsLock(cleanupMutex_);
-
-    int timeout = std::numeric_limits<int>::max(); // not really, but nearly "forever"
-    while (!cleanupCancelled_) {
-        if (std::cv_status::timeout ==
-            cleanupCondition_.wait_for(itsLock, std::chrono::milliseconds(timeout))) {
-            std::lock_guard<std::mutex> lock(sendReceiveMutex_);
-            std::chrono::high_resolution_clock::time_point now = std::chrono::high_resolution_clock::now();
-            auto it = asyncAnswers_.begin();
-            while (it != asyncAnswers_.end()) {
-                if(now > std::get<0>(it->second)) {
-                    std::shared_ptr<vsomeip::message> response
-                        = vsomeip::runtime::get()->create_response(std::get<1>(it->second));
-                    response->set_message_type(vsomeip::message_type_e::MT_ERROR);
-                    response->set_return_code(vsomeip::return_code_e::E_TIMEOUT);
-                    if (auto lockedContext = mainLoopContext_.lock()) {
-                        Watch::msgQueueEntry msg_queue_entry(response, Watch::commDirectionType::PROXYRECEIVE);
-                        watch_->pushQueue(msg_queue_entry);
-                        it++;
-                    } else {
-                        std::get<2>(it->second)->onMessageReply(CallStatus::REMOTE_ERROR, Message(response));
-                        it = asyncAnswers_.erase(it);
-                    }
-                } else {
-                    it++;
-                }
-            }
+void Connection::onCallTimeout(session_id_t _session) const {
+    PendingCallTable::time_point_t now = TimerService::clock_t::now();
+    if (auto lockedContext = mainLoopContext_.lock()) {
+        // The timeout is reported by the main loop
+        std::shared_ptr<vsomeip::message> itsRequest = pendingCalls_.getExpired(_session, now);
+        if (itsRequest) {
+            std::shared_ptr<vsomeip::message> response
+                = vsomeip::runtime::get()->create_response(itsRequest);
+            response->set_message_type(vsomeip::message_type_e::MT_ERROR);
+            response->set_return_code(vsomeip::return_code_e::E_TIMEOUT);
+            Watch::msgQueueEntry msg_queue_entry(response, Watch::commDirectionType::PROXYRECEIVE);
+            watch_->pushQueue(msg_queue_entry);
         }
-
-        {
-            timeout = std::numeric_limits<int>::max();
-            std::chrono::high_resolution_clock::time_point now = std::chrono::high_resolution_clock::now();
-            std::lock_guard<std::mutex> lock(sendReceiveMutex_);
-            for (auto it = asyncAnswers_.begin(); it != asyncAnswers_.end(); it++) {
-                int remaining = (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::get<0>(it->second) - now).count();
-                if (timeout > remaining)
-                    timeout = remaining;
-            }
+    } else {
+        PendingCallTable::Call itsCall;
+        if (pendingCalls_.takeExpired(_session, now, itsCall)) {
+            std::shared_ptr<vsomeip::message> response
+                = vsomeip::runtime::get()->create_response(itsCall.request_);
+            response->set_message_type(vsomeip::message_type_e::MT_ERROR);
+            response->set_return_code(vsomeip::return_code_e::E_TIMEOUT);
+            itsCall.handler_->onMessageReply(CallStatus::REMOTE_ERROR, Message(response));
         }
     }
 }
@@ -195,12 +265,23 @@ Connection::Connection(const std::string &_name)
         executeEndlessPoll(false),
         connectionStatus_(state_type_e::ST_DEREGISTERED),
         application_(vsomeip::runtime::get()->create_application(_name)),
-        sendAndBlockWait_(true),
-        asyncAnswersCleanupThread_(NULL),
-        cleanupCancelled_(false) {
+        timerService_(TimerService::get()) {
 
     application_->init(); //TODO error handling
 
+    std::shared_ptr<Configuration> itsConfiguration = Configuration::get();
+    stubDispatchOrder_ = itsConfiguration->getStubDispatchOrder();
+    if (itsConfiguration->getStubDispatchThreads() > 0) {
+        stubWorkers_ = std::unique_ptr<WorkerPool>(
+                new WorkerPool(itsConfiguration->getStubDispatchThreads()));
+    }
+    if (!itsConfiguration->getServiceAdmissionLimits().empty()
+            || !itsConfiguration->getMethodAdmissionLimits().empty()) {
+        admission_ = std::unique_ptr<AdmissionControl>(
+                new AdmissionControl(itsConfiguration->getServiceAdmissionLimits(),
+                                     itsConfiguration->getMethodAdmissionLimits()));
+    }
+
     std::function<void(state_type_e)> connectionHandler = std::bind(&Connection::onConnectionEvent,
                                                                     this,
                                                                     std::placeholders::_1);
@@ -215,11 +296,8 @@ Connection::~Connection() {
         delete dispatchThread_;
     }
 
-    if (asyncAnswersCleanupThread_) {
-        cleanupCancelled_ = true;
-        cleanupCondition_.notify_one();
-        asyncAnswersCleanupThread_->join();
-    }
+    // No more requests are received, wait for those being dispatched
+    stubWorkers_.reset();
 
     if (auto lockedContext = mainLoopContext_.lock()) {
         lockedContext->deregisterWatch(watch_.get());
@@ -239,7 +317,8 @@ bool Connection::attachMainLoopContext(std::weak_ptr<MainLoopContext> mainLoopCo
         if (!watch_)
             watch_ = std::make_shared<Watch>(shared_from_this());
         if (!dispatchSource_)
-            dispatchSource_ = std::make_shared<DispatchSource>(watch_);
+            dispatchSource_ = std::make_shared<DispatchSource>(watch_,
+                    Configuration::get()->getMainLoopDispatchBudget());
         lockedContext->registerDispatchSource(dispatchSource_.get());
         lockedContext->registerWatch(watch_.get());
 
@@ -254,9 +333,6 @@ bool Connection::attachMainLoopContext(std::weak_ptr<MainLoopContext> mainLoopCo
 bool Connection::connect(bool) {
     std::unique_lock<std::mutex> lock(connectionMutex_);
 
-#ifndef WIN32
-    asyncAnswersCleanupThread_ = std::make_shared<std::thread>(&Connection::cleanup, this);
-#endif
     dispatchThread_ = new std::thread(&Connection::dispatch, this);
     return isConnected();
 }
@@ -307,6 +383,27 @@ bool Connection::sendEvent(const Message &message, client_id_t _client,
     return true;
 }
 
+bool Connection::sendEvent(const Message &message,
+        const std::vector<client_id_t> &_clients) const {
+    // All clients share the serialized payload
+    std::shared_ptr<vsomeip::payload> itsPayload = message.message_->get_payload();
+    for (auto client : _clients) {
+        application_->notify_one(message.getServiceId(), message.getInstanceId(),
+                message.getMethodId(), itsPayload, client);
+    }
+
+    return true;
+}
+
+bool Connection::sendEvents(const std::vector<Message> &_messages) const {
+    for (auto &m : _messages) {
+        application_->notify(m.getServiceId(), m.getInstanceId(),
+                m.getMethodId(), m.message_->get_payload());
+    }
+
+    return true;
+}
+
 std::future<CallStatus> Connection::sendMessageWithReplyAsync(
         const Message& message,
         std::unique_ptr<MessageReplyAsyncHandler> messageReplyAsyncHandler,
@@ -315,7 +412,11 @@ std::future<CallStatus> Connection::sendMessageWithReplyAsync(
     if (!isConnected())
         return std::future<CallStatus>();
 
-    std::lock_guard<std::mutex> lock(sendReceiveMutex_);
+    // The handler is owned by the pending call table as soon as the call
+    // is registered and may be completed (and deleted) immediately.
+    std::future<CallStatus> itsFuture = messageReplyAsyncHandler->getFuture();
+
+    PendingCallTable::generation_t itsGeneration = pendingCalls_.beginSend();
     application_->send(message.message_, true);
 
     if (_info->sender_ != 0) {
@@ -324,13 +425,32 @@ std::future<CallStatus> Connection::sendMessageWithReplyAsync(
                 ", SessionID: ", message.getSessionId());
     }
 
-    MessageReplyAsyncHandler* replyAsyncHandler = messageReplyAsyncHandler.get();
+    // The timer only holds a weak reference, expiring calls must not keep
+    // the connection alive.
+    session_id_t itsSession = message.getSessionId();
+    std::weak_ptr<const Connection> itsConnection(shared_from_this());
+    std::shared_ptr<TimerService::Timer> itsTimer = std::make_shared<TimerService::Timer>(
+            [itsConnection, itsSession]() {
+                if (auto lockedConnection = itsConnection.lock())
+                    lockedConnection->onCallTimeout(itsSession);
+            });
+
+    auto timeoutTime = TimerService::clock_t::now() + std::chrono::milliseconds(_info->timeout_);
+    std::shared_ptr<vsomeip::message> itsReply
+        = pendingCalls_.insert(itsSession,
+                PendingCallTable::Call(timeoutTime, message.message_,
+                    std::move(messageReplyAsyncHandler), itsTimer),
+                itsGeneration);
+    pendingCalls_.endSend(itsGeneration);
 
-    auto timeoutTime = std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(_info->timeout_);
-    asyncAnswers_[message.getSessionId()] = std::make_tuple(timeoutTime, message.message_, std::move(messageReplyAsyncHandler));
-    cleanupCondition_.notify_one();
+    timerService_->start(itsTimer, timeoutTime);
 
-    return replyAsyncHandler->getFuture();
+    if (itsReply) {
+        // The reply overtook the registration of the call
+        proxyReceive(itsReply);
+    }
+
+    return itsFuture;
 }
 
 Message Connection::sendMessageWithReplyAndBlock(
@@ -340,28 +460,49 @@ Message Connection::sendMessageWithReplyAndBlock(
     if (!isConnected())
         return Message();
 
-    {
-        std::unique_lock<std::mutex> lock(sendReceiveMutex_);
-        application_->send(message.message_, true);
+    // Each caller waits on its own slot, so that concurrent blocking calls
+    // neither serialize nor receive each other's replies. The slot does not
+    // expire, the caller removes it itself on timeout.
+    std::shared_ptr<BlockingCall> itsCall = std::make_shared<BlockingCall>();
 
-        if (_info->sender_ != 0) {
-            COMMONAPI_DEBUG("Message sent: SenderID: ", _info->sender_,
-                        " - ClientID: ", message.getClientId(),
-                        ", SessionID: ", message.getSessionId());
-        }
+    PendingCallTable::generation_t itsGeneration = pendingCalls_.beginSend();
+    application_->send(message.message_, true);
 
-        sendAndBlockAnswer_.first = message.getSessionId();
+    if (_info->sender_ != 0) {
+        COMMONAPI_DEBUG("Message sent: SenderID: ", _info->sender_,
+                    " - ClientID: ", message.getClientId(),
+                    ", SessionID: ", message.getSessionId());
+    }
+
+    session_id_t itsSession = message.getSessionId();
+    std::shared_ptr<vsomeip::message> itsReply
+        = pendingCalls_.insert(itsSession,
+                PendingCallTable::Call(PendingCallTable::time_point_t::max(), message.message_,
+                    std::unique_ptr<MessageReplyAsyncHandler>(new BlockingCallHandler(itsCall))),
+                itsGeneration);
+    pendingCalls_.endSend(itsGeneration);
+
+    if (itsReply) {
+        proxyReceive(itsReply);
     }
 
-    std::unique_lock<std::mutex> lock(sendAndBlockMutex_);
-    std::cv_status waitStatus = std::cv_status::no_timeout;
+    std::unique_lock<std::mutex> lock(itsCall->mutex_);
+    if (!itsCall->condition_.wait_for(lock,
+            std::chrono::milliseconds(_info->timeout_),
+            [&itsCall]() { return itsCall->isAnswered_; })) {
+        lock.unlock();
+
+        PendingCallTable::Call itsTimedOutCall;
+        if (pendingCalls_.remove(itsSession, itsTimedOutCall)) {
+            return Message();
+        }
 
-    if(sendAndBlockWait_) {
-        waitStatus = sendAndBlockCondition_.wait_for(lock, std::chrono::milliseconds(_info->timeout_));
+        // The reply is being delivered right now
+        lock.lock();
+        itsCall->condition_.wait(lock, [&itsCall]() { return itsCall->isAnswered_; });
     }
-    sendAndBlockWait_ = true;
 
-    return (waitStatus == std::cv_status::no_timeout) ? sendAndBlockAnswer_.second : Message();
+    return itsCall->answer_;
 }
 
 void Connection::addEventHandler(
@@ -374,6 +515,7 @@ void Connection::addEventHandler(
 
     std::unique_lock<std::mutex> lock(eventHandlerMutex_);
     eventHandlers_[serviceId][instanceId][eventId].insert(eventHandler);
+    updateEventHandlerTable();
     subscriptions_[serviceId][instanceId].insert(eventGroupId);
 
     if (application_->is_available(serviceId, instanceId))
@@ -397,6 +539,7 @@ void Connection::removeEventHandler(
                 foundEventId->second.erase(eventHandler);
                 if (foundEventId->second.size() == 0)
                     foundInstance->second.erase(foundEventId);
+                updateEventHandlerTable();
                 application_->unsubscribe(serviceId, instanceId, eventGroupId);
             }
         }
@@ -424,6 +567,41 @@ void Connection::removeEventHandler(
     }
 }
 
+void Connection::updateEventHandlerTable() {
+    std::vector<std::pair<uint64_t, std::vector<EventHandlerEntry>>> itsEntries;
+    for (auto &s : eventHandlers_) {
+        for (auto &i : s.second) {
+            for (auto &e : i.second) {
+                // Group the handlers that share their decoding
+                std::vector<std::vector<ProxyConnection::EventHandler *>> itsGroups;
+                for (auto h : e.second) {
+                    auto foundGroup = itsGroups.begin();
+                    while (foundGroup != itsGroups.end()
+                            && !foundGroup->front()->sharesEventDecoding(h))
+                        foundGroup++;
+                    if (foundGroup != itsGroups.end()) {
+                        foundGroup->push_back(h);
+                    } else {
+                        itsGroups.push_back(std::vector<ProxyConnection::EventHandler *>(1, h));
+                    }
+                }
+
+                std::vector<EventHandlerEntry> itsHandlers;
+                for (auto &g : itsGroups) {
+                    for (size_t k = 0; k < g.size(); k++) {
+                        EventHandlerEntry itsEntry = { g[k], k > 0 };
+                        itsHandlers.push_back(itsEntry);
+                    }
+                }
+                itsEntries.push_back(std::make_pair(packKey(s.first, i.first, e.first),
+                        std::move(itsHandlers)));
+            }
+        }
+    }
+    eventHandlerTable_.update(
+            std::unique_ptr<event_handler_table_t>(new event_handler_table_t(itsEntries)));
+}
+
 bool
 Connection::isAvailable(const Address &_address) {
     return application_->is_available(_address.getService(), _address.getInstance());
@@ -598,6 +776,18 @@ bool Connection::isStubMessageHandlerSet() {
     return stubMessageHandler_.operator bool();
 }
 
+std::shared_ptr<ClientId> Connection::getClientId(client_id_t _client) const {
+    return clientIds_.get(_client);
+}
+
+uint64_t Connection::getShedRequestCount(service_id_t _service) const {
+    return (admission_ ? admission_->getShedCount(_service) : 0);
+}
+
+uint64_t Connection::getShedRequestCount(service_id_t _service, method_id_t _method) const {
+    return (admission_ ? admission_->getShedCount(_service, _method) : 0);
+}
+
 void Connection::processMsgQueueEntry(Watch::msgQueueEntry &_msgQueueEntry) {
     Watch::commDirectionType commDirType = _msgQueueEntry.second;
 
@@ -12,9 +12,10 @@
 namespace CommonAPI {
 namespace SomeIP {
 
-DispatchSource::DispatchSource(const std::shared_ptr<Watch>& watch) :
-    watch_(watch) {
+DispatchSource::DispatchSource(const std::shared_ptr<Watch>& watch, std::size_t _budget) :
+    watch_(watch), budget_(_budget > 0 ? _budget : 1) {
     watch_->addDependentDispatchSource(this);
+    entries_.reserve(budget_);
 }
 
 DispatchSource::~DispatchSource() {
@@ -35,13 +36,13 @@ bool DispatchSource::check() {
 
 bool DispatchSource::dispatch() {
     std::unique_lock<std::mutex> itsLock(watchMutex_);
-    if (!watch_->emptyQueue()) {
-        auto msgQueueEntry = watch_->frontQueue();
-        watch_->popQueue();
-        watch_->processMsgQueueEntry(msgQueueEntry);
+    bool hasMore = watch_->popQueue(entries_, budget_);
+    for (auto &e : entries_) {
+        watch_->processMsgQueueEntry(e);
     }
+    entries_.clear();
 
-    return !watch_->emptyQueue();
+    return hasMore;
 }
 
 } // namespace SomeIP
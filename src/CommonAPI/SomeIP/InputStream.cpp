@@ -124,91 +124,138 @@ InputStream& InputStream::readValue(std::string &_value, const EmptyDeployment *
 
 InputStream& InputStream::readValue(std::string &_value, const StringDeployment *_depl) {
     uint32_t itsSize(0);
+    byte_t *itsData = _readString(itsSize, _depl);
 
+    if (!hasError()) {
+        StringEncoding itsEncoding = (_depl ? _depl->stringEncoding_ : StringEncoding::UTF8);
+        if (itsEncoding == StringEncoding::UTF8) {
+            _value.assign(reinterpret_cast<const char *>(itsData), itsSize);
+        } else if (!_decodeString(itsData, itsSize, itsEncoding, _value)) {
+            errorOccurred_ = true;
+        }
+    }
+
+    if (hasError()) {
+        _value.clear();
+    }
+
+    return *this;
+}
+
+InputStream& InputStream::readValue(StringView &_value, const EmptyDeployment *) {
+    return readValue(_value, static_cast<const StringDeployment *>(nullptr));
+}
+
+InputStream& InputStream::readValue(StringView &_value, const StringDeployment *_depl) {
+    uint32_t itsSize(0);
+    byte_t *itsData = _readString(itsSize, _depl);
+
+    if (!hasError()) {
+        StringEncoding itsEncoding = (_depl ? _depl->stringEncoding_ : StringEncoding::UTF8);
+        if (itsEncoding == StringEncoding::UTF8) {
+            _value = StringView(message_, reinterpret_cast<const char *>(itsData), itsSize);
+        } else {
+            std::string itsValue;
+            if (_decodeString(itsData, itsSize, itsEncoding, itsValue)) {
+                _value = StringView::fromString(std::move(itsValue));
+            } else {
+                errorOccurred_ = true;
+            }
+        }
+    }
+
+    if (hasError()) {
+        _value = StringView();
+    }
+
+    return *this;
+}
+
+byte_t *InputStream::_readString(uint32_t &_size, const StringDeployment *_depl) {
     // Read string size
     if (_depl != nullptr) {
         if (_depl->stringLengthWidth_ == 0) {
-            itsSize = _depl->stringLength_;
+            _size = _depl->stringLength_;
         } else {
-            readValue(itsSize, _depl->stringLengthWidth_, false);
+            readValue(_size, _depl->stringLengthWidth_, false);
         }
     } else {
-        readValue(itsSize, 4, false);
+        readValue(_size, 4, false);
     }
 
-    if(itsSize > remaining_) {
+    if (_size > remaining_) {
         errorOccurred_ = true;
     }
 
-    // Read string, if reading size has been successful
-    if(!hasError()) {
-
-        byte_t *data = _readRaw(itsSize);
+    if (hasError()) {
+        _size = 0;
+        return nullptr;
+    }
 
-        std::shared_ptr<StringEncoder> encoder = std::make_shared<StringEncoder>();
-        byte_t *bytes = NULL;
+    byte_t *itsData = _readRaw(_size);
+    StringEncoding itsEncoding = (_depl ? _depl->stringEncoding_ : StringEncoding::UTF8);
 
-        if(_depl != nullptr)
-        {
-            EncodingStatus status = EncodingStatus::UNKNOWN;
-            size_t length = 0;
-
-            if (encoder->checkBom(data, itsSize, _depl->stringEncoding_)) {
-                switch (_depl->stringEncoding_)
-                {
-                    case StringEncoding::UTF16BE:
-                        //TODO do not return error if itsSize is odd and itsSize is too short
-                        if(itsSize % 2 != 0 && data[itsSize - 1] == 0x00 && data[itsSize - 2] == 0x00 )
-                            errorOccurred_ = true;
-                        if(!hasError())
-                            encoder->utf16To8((byte_t *) data, BIG_ENDIAN, itsSize - 2, status, &bytes, length);
-                        break;
-
-                    case StringEncoding::UTF16LE:
-                        if(itsSize % 2 != 0 && data[itsSize - 1] == 0x00 && data[itsSize - 2] == 0x00 )
-                            errorOccurred_ = true;
-                        if(!hasError())
-                            encoder->utf16To8((byte_t *) data, LITTLE_ENDIAN, itsSize - 2, status, &bytes, length);
-                        break;
-
-                    default:
-                        bytes = (byte_t *) data;
-                        break;
-                }
-
-                status = EncodingStatus::SUCCESS;
-            } else {
-                status = EncodingStatus::INVALID_BOM;
-            }
+    StringEncoder itsEncoder;
+    if (!itsEncoder.checkBom(itsData, _size, itsEncoding)) {
+        errorOccurred_ = true;
+        _size = 0;
+        return nullptr;
+    }
 
-            if(status != EncodingStatus::SUCCESS)
-            {
-                errorOccurred_ = true;
-            }
-        } else
-        {
-            if (encoder->checkBom(data, itsSize, StringEncoding::UTF8)) {
-                bytes = new byte_t[itsSize];
-                memcpy(bytes, (byte_t *) data, itsSize);
-            }
-            else
-                errorOccurred_ = true;
+    // Strip the termination. The BOM check guarantees at least two bytes.
+    if (itsEncoding == StringEncoding::UTF8) {
+        // The string ends at the first zero, fixed length strings are
+        // padded with zeros
+        byte_t *itsEnd = static_cast<byte_t *>(std::memchr(itsData, 0x00, _size));
+        if (itsEnd != nullptr) {
+            _size = uint32_t(itsEnd - itsData);
+        }
+    } else {
+        //TODO do not return error if _size is odd and _size is too short
+        if (_size % 2 != 0 && itsData[_size - 1] == 0x00 && itsData[_size - 2] == 0x00) {
+            errorOccurred_ = true;
+            _size = 0;
+            return nullptr;
         }
-        if (bytes == NULL) {
-	        _value = "";
-	    } else {
-	        _value = (char*)bytes;
-	        //only delete bytes if not allocated in this function (this is the case for deployed fixed length UTF8 strings)
-	        if( bytes != (byte_t *) data)
-	            delete[] bytes;
-	        bytes = NULL;
-	    }
+        _size -= 2;
     }
 
-    return *this;
+    return itsData;
+}
+
+bool InputStream::_decodeString(byte_t *_data, uint32_t _size,
+                                StringEncoding _encoding, std::string &_value) {
+    StringEncoder itsEncoder;
+    EncodingStatus itsStatus(EncodingStatus::UNKNOWN);
+
+    // Decode directly into the string, a UTF-16 code unit takes at most three UTF-8 bytes
+    _value.resize(_size / 2 * 3);
+    size_t itsLength = itsEncoder.utf16To8(_data, _size,
+                           (_encoding == StringEncoding::UTF16BE ? BIG_ENDIAN : LITTLE_ENDIAN),
+                           reinterpret_cast<byte_t *>(&_value[0]), itsStatus);
+    _value.resize(itsLength);
+
+    return (itsStatus == EncodingStatus::SUCCESS);
 }
 
 InputStream& InputStream::readValue(ByteBuffer &_value, const ByteBufferDeployment *_depl) {
+    ByteBufferView itsView;
+    readValue(itsView, _depl);
+
+    if (!hasError()) {
+        _value.assign(itsView.begin(), itsView.end());
+    } else {
+        _value.clear();
+    }
+
+    return (*this);
+}
+
+InputStream& InputStream::readValue(ByteBufferView &_value, const EmptyDeployment *) {
+    return readValue(_value, static_cast<const ByteBufferDeployment *>(nullptr));
+}
+
+InputStream& InputStream::readValue(ByteBufferView &_value, const ByteBufferDeployment *_depl) {
     uint32_t byteBufferMinLength = (_depl ? _depl->byteBufferMinLength_ : 0);
     uint32_t byteBufferMaxLength = (_depl ? _depl->byteBufferMaxLength_ : 0xFFFFFFFF);
 
@@ -217,24 +264,13 @@ InputStream& InputStream::readValue(ByteBuffer &_value, const ByteBufferDeployme
     // Read array size
     readValue(itsSize, 4, true);
 
-    // Reset target
-    _value.clear();
+    if (itsSize > remaining_) {
+        errorOccurred_ = true;
+    }
 
     // Read elements, if reading size has been successful
     if (!hasError()) {
-        while (itsSize > 0) {
-            size_t remainingBeforeRead = remaining_;
-
-            uint8_t itsElement;
-            readValue(itsElement, nullptr);
-            if (hasError()) {
-                break;
-            }
-
-            _value.push_back(std::move(itsElement));
-
-            itsSize -= uint32_t(remainingBeforeRead - remaining_);
-        }
+        _value = ByteBufferView(message_, _readRaw(itsSize), itsSize);
 
         if (byteBufferMinLength != 0 && _value.size() < byteBufferMinLength) {
             errorOccurred_ = true;
@@ -242,6 +278,8 @@ InputStream& InputStream::readValue(ByteBuffer &_value, const ByteBufferDeployme
         if (byteBufferMaxLength != 0 && _value.size() > byteBufferMaxLength) {
             errorOccurred_ = true;
         }
+    } else {
+        _value = ByteBufferView();
     }
 
     return (*this);
@@ -177,5 +177,25 @@ Message::setPayloadData(const byte_t* data, message_length_t length) {
     payload->set_data(data, length);
 }
 
+void
+Message::setPayloadData(std::vector<byte_t> &&_data) {
+    std::shared_ptr<vsomeip::payload> payload = message_->get_payload();
+    if(!payload) {
+        payload = vsomeip::runtime::get()->create_payload();
+        message_->set_payload(payload);
+    }
+    payload->set_data(std::move(_data));
+}
+
+std::shared_ptr<vsomeip::payload>
+Message::getPayload() const {
+    return message_->get_payload();
+}
+
+void
+Message::setPayload(const std::shared_ptr<vsomeip::payload> &_payload) {
+    message_->set_payload(_payload);
+}
+
 } // namespace SomeIP
 } // namespace CommonAPI
@@ -20,7 +20,8 @@ namespace SomeIP {
 
 OutputStream::OutputStream(Message message)
     : message_(message),
-      errorOccurred_(false) {
+      errorOccurred_(false),
+      numPositions_(0) {
 }
 
 OutputStream::~OutputStream() {
@@ -32,12 +33,23 @@ size_t OutputStream::getPosition() {
 }
 
 void OutputStream::pushPosition() {
-    positions_.push(payload_.size());
+    if (numPositions_ < INLINE_POSITIONS) {
+        positions_[numPositions_] = payload_.size();
+    } else {
+        morePositions_.push_back(payload_.size());
+    }
+    numPositions_++;
 }
 
 size_t OutputStream::popPosition() {
-    size_t itsPosition = positions_.top();
-    positions_.pop();
+    assert(numPositions_ > 0);
+    numPositions_--;
+    if (numPositions_ < INLINE_POSITIONS) {
+        return positions_[numPositions_];
+    }
+
+    size_t itsPosition = morePositions_.back();
+    morePositions_.pop_back();
     return itsPosition;
 }
 
@@ -140,90 +152,75 @@ OutputStream& OutputStream::writeValue(const std::string &_value, const EmptyDep
 }
 
 OutputStream& OutputStream::writeValue(const std::string &_value, const StringDeployment *_depl) {
+    return writeValue(StringView(_value), _depl);
+}
 
-    bool errorOccurred = false;
-    size_t size, terminationSize(2);
-    size_t bomSize(2);
-    byte_t *bytes;
-
-    //Determine string length
-    if(_depl != nullptr)
-    {
-        EncodingStatus status = EncodingStatus::SUCCESS;
-        std::shared_ptr<StringEncoder> encoder = std::make_shared<StringEncoder>();
-
-        switch (_depl->stringEncoding_)
-        {
-            case StringEncoding::UTF16BE:
-                encoder->utf8To16((byte_t *)_value.c_str(), BIG_ENDIAN, status, &bytes, size);
-                break;
-
-            case StringEncoding::UTF16LE:
-                encoder->utf8To16((byte_t *)_value.c_str(), LITTLE_ENDIAN, status, &bytes, size);
-                break;
-
-            default:
-                bytes = (byte_t *)(_value.c_str());
-                size = _value.size();
-                bomSize = 3;
-                terminationSize = 1;
-                break;
-        }
-
-        if(status != EncodingStatus::SUCCESS)
-        {
-            //TODO error handling
-        }
-
-    } else
-    {
-        bytes = (byte_t *)(_value.c_str());
-        size = _value.size();
-        bomSize = 3;
-        terminationSize = 1;
-    }
+OutputStream& OutputStream::writeValue(const StringView &_value, const EmptyDeployment *) {
+    return writeValue(_value, static_cast<const StringDeployment *>(nullptr));
+}
 
-    //write string length
-    if (_depl != nullptr) {
-        if (_depl->stringLengthWidth_ == 0
-                && _depl->stringLength_  != size + terminationSize + bomSize ) {
-                errorOccurred = true;
-        } else {
-            _writeValue(uint32_t(size + terminationSize + bomSize),
-                    _depl->stringLengthWidth_);
-        }
-    } else {
-        _writeValue(uint32_t(size + terminationSize + bomSize), 4);
-    }
+OutputStream& OutputStream::writeValue(const StringView &_value, const StringDeployment *_depl) {
+    const uint8_t itsLengthWidth = (_depl ? _depl->stringLengthWidth_ : 4);
+    const StringEncoding itsEncoding = (_depl ? _depl->stringEncoding_ : StringEncoding::UTF8);
 
+    // Write a placeholder for the length field, it is set as soon as the
+    // length of the encoded string is known
+    const size_t itsLengthPosition = payload_.size();
+    _writeValue(uint32_t(0), itsLengthWidth);
+    const size_t itsStringPosition = payload_.size();
 
-    if(!errorOccurred) {
-        // Write BOM
-        _writeBom(_depl);
+    // Write BOM
+    _writeBom(_depl);
 
-        // Write sting content
-        _writeRaw(bytes, size);
+    // Write string content and termination
+    const byte_t *itsSource = reinterpret_cast<const byte_t *>(_value.data());
+    if (itsEncoding == StringEncoding::UTF8) {
+        _writeRaw(itsSource, _value.size());
+        _writeRaw(byte_t(0x00));
+    } else {
+        // Encode directly into the payload, a UTF-8 byte results in at most two UTF-16 bytes
+        const size_t itsPosition = payload_.size();
+        byte_t *itsTarget = _appendRaw(2 * _value.size() + 2);
+
+        StringEncoder itsEncoder;
+        EncodingStatus itsStatus(EncodingStatus::UNKNOWN);
+        size_t itsLength = itsEncoder.utf8To16(itsSource, _value.size(),
+                               (itsEncoding == StringEncoding::UTF16BE ? BIG_ENDIAN : LITTLE_ENDIAN),
+                               itsTarget, itsStatus);
+        if (itsStatus != EncodingStatus::SUCCESS) {
+            errorOccurred_ = true;
+        }
 
-        // Write termination
-        const byte_t termination[] = { 0x00, 0x00 };
-        _writeRaw(termination, terminationSize);
+        itsTarget[itsLength] = 0x00;
+        itsTarget[itsLength + 1] = 0x00;
+        payload_.truncate(itsPosition + itsLength + 2);
     }
 
-    if (bytes != (byte_t*)_value.c_str()) {
-        delete [] bytes;
+    // Write string length
+    const size_t itsSize = payload_.size() - itsStringPosition;
+    if (itsLengthWidth == 0) {
+        if (_depl->stringLength_ != itsSize) {
+            payload_.truncate(itsLengthPosition);
+        }
+    } else {
+        _writeValueAt(uint32_t(itsSize), itsLengthWidth, uint32_t(itsLengthPosition));
     }
 
     return (*this);
 }
 
 OutputStream& OutputStream::writeValue(const ByteBuffer &_value, const ByteBufferDeployment *_depl) {
+    return writeValue(ByteBufferView(_value), _depl);
+}
+
+OutputStream& OutputStream::writeValue(const ByteBufferView &_value, const EmptyDeployment *) {
+    return writeValue(_value, static_cast<const ByteBufferDeployment *>(nullptr));
+}
+
+OutputStream& OutputStream::writeValue(const ByteBufferView &_value, const ByteBufferDeployment *_depl) {
     uint32_t byteBufferMinLength = (_depl ? _depl->byteBufferMinLength_ : 0);
     uint32_t byteBufferMaxLength = (_depl ? _depl->byteBufferMaxLength_ : 0xFFFFFFFF);
 
-    pushPosition();     // Start of length field
-    _writeValue(0, 4);  // Length field placeholder
-    pushPosition();     // Start of vector data
-
     if (byteBufferMinLength != 0 && _value.size() < byteBufferMinLength) {
         errorOccurred_ = true;
     }
@@ -231,21 +228,12 @@ OutputStream& OutputStream::writeValue(const ByteBuffer &_value, const ByteBuffe
         errorOccurred_ = true;
     }
 
+    // Write length field and content
+    _writeValue(uint32_t(_value.size()), 4);
     if (!hasError()) {
-        // Write array/vector content
-        for (auto i : _value) {
-            writeValue(i, nullptr);
-            if (hasError()) {
-                break;
-            }
-        }
+        _writeRaw(_value.data(), _value.size());
     }
 
-    // Write actual value of length field
-    size_t length = getPosition() - popPosition();
-    size_t position2Write = popPosition();
-    _writeValueAt(uint32_t(length), 4, uint32_t(position2Write));
-
     return (*this);
 }
 
@@ -273,11 +261,15 @@ void OutputStream::align(const size_t _boundary) {
 }
 
 void OutputStream::_writeRaw(const byte_t &_data) {
-    payload_.push_back(_data);
+    *payload_.append(1) = _data;
 }
 
 void OutputStream::_writeRaw(const byte_t *_data, const size_t _size) {
-    payload_.insert(payload_.end(), _data, _data + _size);
+    payload_.append(_data, _size);
+}
+
+byte_t *OutputStream::_appendRaw(const size_t _size) {
+    return payload_.append(_size);
 }
 
 void OutputStream::_writeRawAt(const byte_t *_data, const size_t _size, const size_t _position) {
@@ -302,10 +294,16 @@ void OutputStream::_writeBom(const StringDeployment *_depl) {
 }
 
 void OutputStream::flush() {
-    message_.setPayloadData((byte_t *)payload_.data(), uint32_t(payload_.size()));
+    if (payload_.isInline()) {
+        message_.setPayloadData(payload_.data(), message_length_t(payload_.size()));
+        payload_.clear();
+    } else {
+        message_.setPayloadData(payload_.release());
+    }
 }
 
-void OutputStream::reserveMemory(size_t) {
+void OutputStream::reserveMemory(size_t _numOfBytes) {
+    payload_.reserve(payload_.size() + _numOfBytes);
 }
 
 } // namespace SomeIP
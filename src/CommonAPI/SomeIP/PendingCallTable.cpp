@@ -0,0 +1,177 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <CommonAPI/SomeIP/PendingCallTable.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+const size_t PendingCallTable::SHARD_COUNT;
+const size_t PendingCallTable::SEND_SLOT_COUNT;
+
+PendingCallTable::PendingCallTable()
+    : generation_(0), sending_(0), parked_(0), overflowCount_(0) {
+    for (auto &itsSlot : sendSlots_) {
+        itsSlot.store(0, std::memory_order_relaxed);
+    }
+}
+
+PendingCallTable::generation_t PendingCallTable::beginSend() {
+    generation_t itsGeneration = generation_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    sending_.fetch_add(1, std::memory_order_acq_rel);
+
+    // The generation is recorded before sending, hence the reply can only
+    // arrive while it is visible as in progress.
+    for (size_t i = 0; i < SEND_SLOT_COUNT; i++) {
+        size_t itsSlot = size_t((itsGeneration + i) % SEND_SLOT_COUNT);
+        generation_t itsFree(0);
+        if (sendSlots_[itsSlot].compare_exchange_strong(itsFree, itsGeneration,
+                std::memory_order_acq_rel)) {
+            return itsGeneration;
+        }
+    }
+
+    std::lock_guard<std::mutex> itsLock(overflowMutex_);
+    overflow_.insert(itsGeneration);
+    overflowCount_.fetch_add(1, std::memory_order_acq_rel);
+    return itsGeneration;
+}
+
+void PendingCallTable::endSend(generation_t _generation) {
+    bool isFound(false);
+    for (size_t i = 0; !isFound && i < SEND_SLOT_COUNT; i++) {
+        size_t itsSlot = size_t((_generation + i) % SEND_SLOT_COUNT);
+        if (sendSlots_[itsSlot].load(std::memory_order_acquire) == _generation) {
+            sendSlots_[itsSlot].store(0, std::memory_order_release);
+            isFound = true;
+        }
+    }
+
+    if (!isFound) {
+        std::lock_guard<std::mutex> itsLock(overflowMutex_);
+        overflow_.erase(_generation);
+        overflowCount_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    sending_.fetch_sub(1, std::memory_order_acq_rel);
+
+    if (parked_.load(std::memory_order_acquire) > 0) {
+        dropEarlyReplies();
+    }
+}
+
+std::shared_ptr<vsomeip::message>
+PendingCallTable::insert(session_id_t _session, Call &&_call, generation_t _generation) {
+    Shard &itsShard = getShard(_session);
+    std::lock_guard<std::mutex> itsLock(itsShard.mutex_);
+
+    itsShard.calls_[_session] = std::move(_call);
+
+    std::shared_ptr<vsomeip::message> itsReply;
+    auto foundReply = itsShard.early_.find(_session);
+    if (foundReply != itsShard.early_.end()) {
+        // A reply parked before this send began answers an earlier call
+        // that used the same session.
+        if (foundReply->second.generation_ >= _generation) {
+            itsReply = foundReply->second.reply_;
+        }
+        itsShard.early_.erase(foundReply);
+        parked_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    return itsReply;
+}
+
+bool PendingCallTable::complete(const std::shared_ptr<vsomeip::message> &_reply, Call &_call) {
+    const session_id_t itsSession = _reply->get_session();
+    Shard &itsShard = getShard(itsSession);
+    std::lock_guard<std::mutex> itsLock(itsShard.mutex_);
+
+    auto foundCall = itsShard.calls_.find(itsSession);
+    if (foundCall != itsShard.calls_.end()) {
+        _call = std::move(foundCall->second);
+        itsShard.calls_.erase(foundCall);
+        return true;
+    }
+
+    // A sender that has not yet registered its call holds sending_ above
+    // zero until it has. Otherwise the reply is late and can be dropped.
+    if (sending_.load(std::memory_order_acquire) > 0) {
+        EarlyReply &itsEarly = itsShard.early_[itsSession];
+        if (!itsEarly.reply_) {
+            parked_.fetch_add(1, std::memory_order_acq_rel);
+        }
+        itsEarly.reply_ = _reply;
+        itsEarly.generation_ = generation_.load(std::memory_order_acquire);
+    }
+    return false;
+}
+
+void PendingCallTable::dropEarlyReplies() {
+    generation_t itsOldest(0);
+    for (auto &itsSlot : sendSlots_) {
+        generation_t itsGeneration = itsSlot.load(std::memory_order_acquire);
+        if (itsGeneration != 0 && (itsOldest == 0 || itsGeneration < itsOldest)) {
+            itsOldest = itsGeneration;
+        }
+    }
+    if (overflowCount_.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> itsLock(overflowMutex_);
+        if (!overflow_.empty() && (itsOldest == 0 || *overflow_.begin() < itsOldest)) {
+            itsOldest = *overflow_.begin();
+        }
+    }
+
+    for (auto &itsShard : shards_) {
+        std::lock_guard<std::mutex> itsLock(itsShard.mutex_);
+        for (auto it = itsShard.early_.begin(); it != itsShard.early_.end();) {
+            if (itsOldest == 0 || it->second.generation_ < itsOldest) {
+                it = itsShard.early_.erase(it);
+                parked_.fetch_sub(1, std::memory_order_acq_rel);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+bool PendingCallTable::remove(session_id_t _session, Call &_call) {
+    Shard &itsShard = getShard(_session);
+    std::lock_guard<std::mutex> itsLock(itsShard.mutex_);
+
+    auto foundCall = itsShard.calls_.find(_session);
+    if (foundCall != itsShard.calls_.end()) {
+        _call = std::move(foundCall->second);
+        itsShard.calls_.erase(foundCall);
+        return true;
+    }
+    return false;
+}
+
+bool PendingCallTable::takeExpired(session_id_t _session, const time_point_t &_now, Call &_call) {
+    Shard &itsShard = getShard(_session);
+    std::lock_guard<std::mutex> itsLock(itsShard.mutex_);
+
+    auto foundCall = itsShard.calls_.find(_session);
+    if (foundCall != itsShard.calls_.end() && _now >= foundCall->second.timeout_) {
+        _call = std::move(foundCall->second);
+        itsShard.calls_.erase(foundCall);
+        return true;
+    }
+    return false;
+}
+
+std::shared_ptr<vsomeip::message>
+PendingCallTable::getExpired(session_id_t _session, const time_point_t &_now) {
+    Shard &itsShard = getShard(_session);
+    std::lock_guard<std::mutex> itsLock(itsShard.mutex_);
+
+    auto foundCall = itsShard.calls_.find(_session);
+    if (foundCall != itsShard.calls_.end() && _now >= foundCall->second.timeout_) {
+        return foundCall->second.request_;
+    }
+    return nullptr;
+}
+
+} // namespace SomeIP
+} // namespace CommonAPI
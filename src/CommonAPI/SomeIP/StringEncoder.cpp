@@ -3,8 +3,15 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <cstring>
+
 #include <CommonAPI/SomeIP/StringEncoder.hpp>
 
+#if defined(__SSE2__)
+#define COMMONAPI_SOMEIP_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace CommonAPI {
 namespace SomeIP {
 
@@ -15,6 +22,127 @@ const uint16_t SURROGATE_MAX        = 0xdfff;
 const uint32_t CODE_POINT_MAX       = 0x0010ffff;
 const uint16_t UNICODE_MAX          = 0xffff;
 
+namespace {
+
+// Returns the length of the leading part of _bytes that consists of
+// complete blocks of ASCII characters.
+size_t skipAscii(const byte_t *_bytes, size_t _size) {
+    size_t i(0);
+#ifdef COMMONAPI_SOMEIP_HAS_SSE2
+    for (; i + 16 <= _size; i += 16) {
+        __m128i itsBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_bytes + i));
+        if (_mm_movemask_epi8(itsBlock) != 0)
+            break;
+    }
+#else
+    for (; i + 8 <= _size; i += 8) {
+        uint64_t itsBlock;
+        std::memcpy(&itsBlock, _bytes + i, sizeof(itsBlock));
+        if ((itsBlock & 0x8080808080808080ULL) != 0)
+            break;
+    }
+#endif
+    return i;
+}
+
+// Converts the leading blocks of ASCII characters to UTF-16 code units.
+// Returns the number of characters that have been converted.
+size_t widenAscii(const byte_t *_source, size_t _size, bool _isBigEndian, byte_t *_target) {
+    size_t i(0);
+#ifdef COMMONAPI_SOMEIP_HAS_SSE2
+    const __m128i itsZero = _mm_setzero_si128();
+    for (; i + 16 <= _size; i += 16) {
+        __m128i itsBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_source + i));
+        if (_mm_movemask_epi8(itsBlock) != 0)
+            break;
+
+        __m128i itsLow, itsHigh;
+        if (_isBigEndian) {
+            itsLow = _mm_unpacklo_epi8(itsZero, itsBlock);
+            itsHigh = _mm_unpackhi_epi8(itsZero, itsBlock);
+        } else {
+            itsLow = _mm_unpacklo_epi8(itsBlock, itsZero);
+            itsHigh = _mm_unpackhi_epi8(itsBlock, itsZero);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(_target + 2 * i), itsLow);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(_target + 2 * i + 16), itsHigh);
+    }
+#else
+    (void)_source;
+    (void)_size;
+    (void)_isBigEndian;
+    (void)_target;
+#endif
+    return i;
+}
+
+// Converts the leading blocks of UTF-16 code units below 0x80 to ASCII.
+// Returns the number of code units that have been converted.
+size_t narrowAscii(const byte_t *_source, size_t _units, bool _isBigEndian, byte_t *_target) {
+    size_t i(0);
+#ifdef COMMONAPI_SOMEIP_HAS_SSE2
+    const __m128i itsZero = _mm_setzero_si128();
+    const __m128i itsMask = _mm_set1_epi16(-0x80); // 0xff80
+    for (; i + 16 <= _units; i += 16) {
+        __m128i itsFirst = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_source + 2 * i));
+        __m128i itsSecond = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_source + 2 * i + 16));
+        if (_isBigEndian) {
+            itsFirst = _mm_or_si128(_mm_slli_epi16(itsFirst, 8), _mm_srli_epi16(itsFirst, 8));
+            itsSecond = _mm_or_si128(_mm_slli_epi16(itsSecond, 8), _mm_srli_epi16(itsSecond, 8));
+        }
+
+        __m128i itsHigh = _mm_and_si128(_mm_or_si128(itsFirst, itsSecond), itsMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(itsHigh, itsZero)) != 0xffff)
+            break;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(_target + i),
+                         _mm_packus_epi16(itsFirst, itsSecond));
+    }
+#else
+    (void)_source;
+    (void)_units;
+    (void)_isBigEndian;
+    (void)_target;
+#endif
+    return i;
+}
+
+inline uint32_t getUnit(const byte_t *_source, bool _isBigEndian) {
+    if (_isBigEndian)
+        return uint32_t(_source[0]) << 8 | _source[1];
+    return uint32_t(_source[1]) << 8 | _source[0];
+}
+
+inline void putUnit(byte_t *&_target, uint32_t _unit, bool _isBigEndian) {
+    if (_isBigEndian) {
+        *_target++ = static_cast<byte_t>(_unit >> 8);
+        *_target++ = static_cast<byte_t>(_unit);
+    } else {
+        *_target++ = static_cast<byte_t>(_unit);
+        *_target++ = static_cast<byte_t>(_unit >> 8);
+    }
+}
+
+inline void putCodePoint(byte_t *&_target, uint32_t _codePoint) {
+    if (_codePoint < 0x80) {
+        *_target++ = static_cast<byte_t>(_codePoint);
+    } else if (_codePoint < 0x800) {
+        *_target++ = static_cast<byte_t>((_codePoint >> 6) | 0xc0);               // 0xc0 = 1100 0000 add leading sequence (2 bytes)
+        *_target++ = static_cast<byte_t>((_codePoint & 0x3f) | 0x80);             // 0x80 = 1000 0000 add leading sequence 10 to the following bytes
+    } else if (_codePoint < 0x10000) {
+        *_target++ = static_cast<byte_t>((_codePoint >> 12) | 0xe0);              // 0xe0 = 1110 0000 add leading sequence (3 bytes)
+        *_target++ = static_cast<byte_t>(((_codePoint >> 6) & 0x3f) | 0x80);
+        *_target++ = static_cast<byte_t>((_codePoint & 0x3f) | 0x80);
+    } else {
+        *_target++ = static_cast<byte_t>((_codePoint >> 18) | 0xf0);              // 0xf0 = 1111 0000 add leading sequence (4 bytes)
+        *_target++ = static_cast<byte_t>(((_codePoint >> 12) & 0x3f) | 0x80);
+        *_target++ = static_cast<byte_t>(((_codePoint >> 6) & 0x3f) | 0x80);
+        *_target++ = static_cast<byte_t>((_codePoint & 0x3f) | 0x80);
+    }
+}
+
+} // namespace
+
 bool StringEncoder::checkBom(byte_t *&_data, uint32_t &_size, StringEncoding _encoding) {
     bool result(false);
     if (_size > 3) { // BOM + Termination byte(s)
@@ -48,413 +176,212 @@ bool StringEncoder::checkBom(byte_t *&_data, uint32_t &_size, StringEncoding _en
 
 void StringEncoder::utf16To8(byte_t *_utf16Str, int _endianess, size_t _size, EncodingStatus &_status, byte_t **_result, size_t &_length)
 {
-    _status = EncodingStatus::SUCCESS;
-    bytes_t bytes;
-    int i = 0;
-    while (i < int(_size))
-    {
-        uint32_t firstByte = *_utf16Str & 0xff;
-
-        if (!nextUtf16(&_utf16Str, i, _size, _status))
-        {
-            *_result = new byte_t[0];
-            _length = 0;
-            return;
-        }
-
-        uint32_t secondByte = *_utf16Str & 0xff;
-
-        uint32_t codePoint;
-        if (_endianess == BIG_ENDIAN)
-            codePoint = firstByte << 8 | secondByte;
-        else if (_endianess == LITTLE_ENDIAN)
-            codePoint = secondByte << 8 | firstByte;
-
-        if (isSurrogate(uint16_t(codePoint)))
-        {
-            uint32_t firstSurrogate = codePoint;
-            uint32_t firstSurrogateNoLead = firstSurrogate & 0x3ff; // mask leading surrogate sequence
-
-            if (!nextUtf16(&_utf16Str, i, _size, _status))
-            {
-                *_result = new byte_t[0];
-                _length = 0;
-                return;
-            }
-
-            uint32_t thirdByte = *_utf16Str & 0xff;
-
-            if (!nextUtf16(&_utf16Str, i, _size, _status))
-            {
-                *_result = new byte_t[0];
-                _length = 0;
-                return;
-            }
+    byte_t *itsResult = new byte_t[_size / 2 * 3 + 1];
+    _length = utf16To8(_utf16Str, _size, _endianess, itsResult, _status);
+    if (_status == EncodingStatus::SUCCESS)
+        itsResult[_length++] = '\0';
+    else
+        _length = 0;
+    *_result = itsResult;
+}
 
-            uint32_t fourthByte = *_utf16Str & 0xff;
+void StringEncoder::utf8To16(byte_t *_utf8Str, int _endianess, EncodingStatus &_status, byte_t **_result, size_t &_length)
+{
+    size_t itsSize = std::strlen(reinterpret_cast<const char *>(_utf8Str));
+    byte_t *itsResult = new byte_t[2 * itsSize];
+    _length = utf8To16(_utf8Str, itsSize, _endianess, itsResult, _status);
+    *_result = itsResult;
+}
 
-            uint32_t secondSurrogate;
-            if (_endianess == BIG_ENDIAN)
-                secondSurrogate = thirdByte << 8 | fourthByte;
-            else if (_endianess == LITTLE_ENDIAN)
-                secondSurrogate = fourthByte << 8 | thirdByte;
+bool StringEncoder::isUtf8Valid(byte_t *_utf8Str)
+{
+    return isUtf8Valid(_utf8Str, std::strlen(reinterpret_cast<const char *>(_utf8Str)));
+}
 
-            if (isSurrogate(uint16_t(secondSurrogate)))
-            {
-                uint32_t secondSurrogateNoLead = secondSurrogate & 0x3ff;// mask leading surrogate sequence
+size_t StringEncoder::utf16To8(const byte_t *_utf16Str, size_t _size, int _endianess, byte_t *_target, EncodingStatus &_status)
+{
+    _status = EncodingStatus::SUCCESS;
+    if (_size % 2 != 0)
+    {
+        _status = EncodingStatus::INVALID_UTF16;
+        return 0;
+    }
 
-                codePoint = (firstSurrogateNoLead << 10
-                        | secondSurrogateNoLead) + 0x10000;
+    const bool isBigEndian(_endianess == BIG_ENDIAN);
+    const size_t itsUnits(_size / 2);
+    byte_t *itsTarget = _target;
 
-                bytes_t b = push(codePoint, _status);
-                bytes.insert(bytes.end(), b.begin(), b.end());
-                nextUtf16(&_utf16Str, i, _size, _status);
+    size_t i(0);
+    while (i < itsUnits)
+    {
+        size_t itsAscii = narrowAscii(_utf16Str + 2 * i, itsUnits - i, isBigEndian, itsTarget);
+        i += itsAscii;
+        itsTarget += itsAscii;
 
-            } else
+        // convert (at least) one block sequentially before trying the fast path again
+        const size_t itsBlockEnd = (itsUnits - i > 16 ? i + 16 : itsUnits);
+        while (i < itsBlockEnd)
+        {
+            uint32_t codePoint = getUnit(_utf16Str + 2 * i++, isBigEndian);
+            if (isSurrogate(codePoint))
             {
-                _status = EncodingStatus::INVALID_UTF16;
-                *_result = new byte_t[0];
-                _length = 0;
-                return;
+                if (codePoint >= LOW_SURROGATE_LEAD || i == itsUnits)
+                {
+                    _status = EncodingStatus::INVALID_UTF16;
+                    return 0;
+                }
+
+                uint32_t secondSurrogate = getUnit(_utf16Str + 2 * i++, isBigEndian);
+                if (secondSurrogate < LOW_SURROGATE_LEAD || secondSurrogate > SURROGATE_MAX)
+                {
+                    _status = EncodingStatus::INVALID_UTF16;
+                    return 0;
+                }
+
+                // mask the surrogate leads and sum up the unicode values
+                codePoint = ((codePoint & 0x3ff) << 10 | (secondSurrogate & 0x3ff)) + 0x10000;
             }
-        } else
-        {
-            bytes_t b = push(codePoint, _status);
-            bytes.insert(bytes.end(), b.begin(), b.end());
-            nextUtf16(&_utf16Str, i, _size, _status);
+            putCodePoint(itsTarget, codePoint);
         }
     }
 
-    _length = bytes.size() + 1;
-    byte_t *tmp = new byte_t[_length];
-    int j=0;
-    for(std::vector<byte_t>::iterator it = bytes.begin(); it != bytes.end(); ++it)
-    {
-        tmp[j] = *it;
-        j++;
-    }
-    tmp[_length-1] = '\0';
-    *_result = tmp;
+    return size_t(itsTarget - _target);
 }
 
-void StringEncoder::utf8To16(byte_t *_utf8Str, int _endianess, EncodingStatus &_status, byte_t **_result, size_t &_length)
+size_t StringEncoder::utf8To16(const byte_t *_utf8Str, size_t _size, int _endianess, byte_t *_target, EncodingStatus &_status)
 {
     _status = EncodingStatus::SUCCESS;
 
-    std::vector<byte_t> bytes;
-    while (*_utf8Str != '\0')
-    {
-        uint32_t codePoint = getNextBytes(&_utf8Str, _status);
-        if (codePoint > UNICODE_MAX)
-        {
-            //code point > Unicode max value --> create high and low surrogate
+    const bool isBigEndian(_endianess == BIG_ENDIAN);
+    const byte_t *itsEnd = _utf8Str + _size;
+    byte_t *itsTarget = _target;
 
-            //subtract with 65536 --> results in 20 Bits value
-            uint32_t base = codePoint - 0x10000;
+    while (_utf8Str < itsEnd)
+    {
+        size_t itsAscii = widenAscii(_utf8Str, size_t(itsEnd - _utf8Str), isBigEndian, itsTarget);
+        _utf8Str += itsAscii;
+        itsTarget += 2 * itsAscii;
 
-            //split 20 Bits value. 1-10 bits = part of low surrogate. 11-20 bits = part of high surrogate
+        // convert (at least) one block sequentially before trying the fast path again
+        const byte_t *itsBlockEnd = (itsEnd - _utf8Str > 16 ? _utf8Str + 16 : itsEnd);
+        while (_utf8Str < itsBlockEnd)
+        {
+            uint32_t codePoint = getNextCodePoint(_utf8Str, itsEnd, _status);
+            if (_status != EncodingStatus::SUCCESS)
+                return 0;
 
-            //high surrogate: shift with 10 and add high surrogate lead 110111
-            uint16_t highSurrogate = static_cast<uint16_t>((base >> 10)
-                    + HIGH_SURROGATE_LEAD);
+            if (codePoint > UNICODE_MAX)
+            {
+                //code point > Unicode max value --> create high and low surrogate
 
-            //low surrogate: mask last 10 bits and add low surrogate lead 110110
-            uint16_t lowSurrogate = static_cast<uint16_t>((base & 0x3ff)
-                    + LOW_SURROGATE_LEAD);
+                //subtract with 65536 --> results in 20 Bits value
+                uint32_t base = codePoint - 0x10000;
 
-            if (_endianess == BIG_ENDIAN)
-            {
-                bytes.push_back(static_cast<uint8_t>(highSurrogate >> 8));
-                bytes.push_back(static_cast<uint8_t>(highSurrogate));
-                bytes.push_back(static_cast<uint8_t>(lowSurrogate >> 8));
-                bytes.push_back(static_cast<uint8_t>(lowSurrogate));
-            } else
-            {
-                bytes.push_back(static_cast<uint8_t>(highSurrogate ));
-                bytes.push_back(static_cast<uint8_t>(highSurrogate >> 8));
-                bytes.push_back(static_cast<uint8_t>(lowSurrogate));
-                bytes.push_back(static_cast<uint8_t>(lowSurrogate >> 8));
-            }
-        } else
-        {
-            if (_endianess == BIG_ENDIAN)
-            {
-                bytes.push_back(static_cast<uint8_t>(codePoint >> 8));
-                bytes.push_back(static_cast<uint8_t>(codePoint));
+                //split 20 Bits value. 1-10 bits = part of low surrogate. 11-20 bits = part of high surrogate
+                putUnit(itsTarget, (base >> 10) + HIGH_SURROGATE_LEAD, isBigEndian);
+                putUnit(itsTarget, (base & 0x3ff) + LOW_SURROGATE_LEAD, isBigEndian);
             } else
             {
-                bytes.push_back(static_cast<uint8_t>(codePoint));
-                bytes.push_back(static_cast<uint8_t>(codePoint >> 8));
+                putUnit(itsTarget, codePoint, isBigEndian);
             }
         }
-        _utf8Str++;
     }
 
-    _length = bytes.size();
-    byte_t *tmp = new byte_t[_length];
-    int j=0;
-    for(std::vector<byte_t>::iterator it = bytes.begin(); it != bytes.end(); ++it)
-    {
-        tmp[j] = *it;
-        j++;
-    }
-    *_result = tmp;
+    return size_t(itsTarget - _target);
 }
 
-bool StringEncoder::isUtf8Valid(byte_t *_utf8Str)
+bool StringEncoder::isUtf8Valid(const byte_t *_utf8Str, size_t _size)
 {
-    while (*_utf8Str != '\0')
+    const byte_t *itsEnd = _utf8Str + _size;
+
+    while (_utf8Str < itsEnd)
     {
-        EncodingStatus status;
-        getNextBytes(&_utf8Str, status);
-        if (status != EncodingStatus::SUCCESS)
-            return false;
-        _utf8Str++;
+        _utf8Str += skipAscii(_utf8Str, size_t(itsEnd - _utf8Str));
+
+        const byte_t *itsBlockEnd = (itsEnd - _utf8Str > 16 ? _utf8Str + 16 : itsEnd);
+        while (_utf8Str < itsBlockEnd)
+        {
+            EncodingStatus status(EncodingStatus::SUCCESS);
+            getNextCodePoint(_utf8Str, itsEnd, status);
+            if (status != EncodingStatus::SUCCESS)
+                return false;
+        }
     }
     return true;
 }
 
-bool StringEncoder::isNewSequence(byte_t _byte)
-{
-    return ((_byte >> 6) == 0x2);
-}
-
-bool StringEncoder::isSurrogate(uint16_t _codePoint)
+bool StringEncoder::isSurrogate(uint32_t _codePoint)
 {
     return (_codePoint >= SURROGATE_MIN && _codePoint <= SURROGATE_MAX);
 }
 
 bool StringEncoder::isCodePointValid(uint32_t _codePoint)
 {
-    return (_codePoint <= CODE_POINT_MAX && !isSurrogate(uint16_t(_codePoint)));
-}
-
-bool StringEncoder::isSequenceTooLong(uint32_t _codePoint, int _size)
-{
-    if (_codePoint < 0x80)
-    {
-        if (_size != 1)
-            return true;
-    } else if (_codePoint < 0x800)
-    {
-        if (_size != 2)
-            return true;
-    } else if (_codePoint < 0x10000)
-    {
-        if (_size != 3)
-            return true;
-    }
-    return false;
+    return (_codePoint <= CODE_POINT_MAX && !isSurrogate(_codePoint));
 }
 
-bool StringEncoder::nextUtf8(byte_t **_bytes, EncodingStatus &_status)
+uint32_t StringEncoder::getNextCodePoint(const byte_t *&_bytes, const byte_t *_end, EncodingStatus &_status)
 {
-    (*_bytes)++;
-    if (**_bytes == '\0')
+    byte_t lead = *_bytes;
+    if (lead < 0x80)
     {
-        _status = EncodingStatus::NOT_ENOUGH_ROOM;
-        return false;
+        _bytes++;
+        return lead;
     }
 
-    if (!isNewSequence(**_bytes))
+    size_t sequenceLength;
+    uint32_t codePoint, minCodePoint;
+    if ((lead >> 5) == 0x6)          // lead = 0000 01100 = 6 -> 2 bytes sequence
     {
-        _status = EncodingStatus::INCOMPLETE_SEQUENCE;
-        return false;
-    }
-    return true;
-}
-
-bool StringEncoder::nextUtf16(byte_t **_bytes, int &_index, size_t _length, EncodingStatus &_status)
-{
-    (*_bytes)++;
-    _index++;
-    if (_index > int(_length))
+        sequenceLength = 2;
+        codePoint = lead & 0x1f;
+        minCodePoint = 0x80;
+    } else if ((lead >> 4) == 0xe)   // lead = 0000 11100 = 14 -> 3 bytes sequence
     {
-        _status = EncodingStatus::INVALID_UTF16;
-        return false;
-    }
-    return true;
-}
-
-uint32_t StringEncoder::getByteSequence1(byte_t _byte, EncodingStatus &_status)
-{
-    if (_byte == '\0')
+        sequenceLength = 3;
+        codePoint = lead & 0x0f;
+        minCodePoint = 0x800;
+    } else if ((lead >> 3) == 0x1e)  // lead = 0001 11100 = 30 -> 4 bytes sequence
     {
-        _status = EncodingStatus::NOT_ENOUGH_ROOM;
-        return 0;
-    }
-    return _byte;
-}
-
-uint32_t StringEncoder::getByteSequence2(byte_t **_bytes, EncodingStatus &_status)
-{
-    // 2 bytes utf8 format: 110x xxxx 10xx xxxx
-
-    if (**_bytes == '\0') {
-        _status = EncodingStatus::NOT_ENOUGH_ROOM;
-        return 0;
-    }
-
-    uint32_t codePoint = **_bytes;
-
-    if (!nextUtf8(_bytes, _status))
-        return 0;
-
-    // shift + mask the leading sequence bits and sum up the unicode values
-    codePoint = ((codePoint << 6) & 0x7ff) + (**_bytes & 0x3f);
-
-    return codePoint;
-}
-
-uint32_t StringEncoder::getByteSequence3(byte_t **_bytes, EncodingStatus &_status)
-{
-    // 3 bytes utf8 format: 1110 xxxx 10xx xxxx 10xx xxxx
-
-    if (**_bytes == '\0')
+        sequenceLength = 4;
+        codePoint = lead & 0x07;
+        minCodePoint = 0x10000;
+    } else
     {
-        _status = EncodingStatus::NOT_ENOUGH_ROOM;
+        _status = EncodingStatus::INVALID_LEAD;
         return 0;
     }
 
-    uint32_t codePoint = **_bytes;
-
-    if (!nextUtf8(_bytes, _status))
-        return 0;
-
-    // shift + mask the leading sequence bits and sum up the unicode values
-    codePoint = ((codePoint << 12) & 0xffff) + (**_bytes << 6 & 0xfff);
-
-    if (!nextUtf8(_bytes, _status))
-        return 0;
-
-    // mask the leading sequence bits and sum up the unicode values
-    codePoint += **_bytes & 0x3f;
-
-    return codePoint;
-}
-
-uint32_t StringEncoder::getByteSequence4(byte_t **_bytes, EncodingStatus &_status)
-{
-    // 4 bytes utf8 format: 1111 0xxx 10xx xxxx 10xx xxxx 10xx xxxx
-
-    if (**_bytes == '\0')
+    if (size_t(_end - _bytes) < sequenceLength)
     {
         _status = EncodingStatus::NOT_ENOUGH_ROOM;
         return 0;
     }
 
-    uint32_t codePoint = **_bytes;
-
-    if (!nextUtf8(_bytes, _status))
-        return 0;
-
-    // shift + mask the leading sequence bits and sum up the unicode values
-    codePoint = ((codePoint << 18) & 0x1fffff) + (**_bytes << 12 & 0x3ffff);
-
-    if (!nextUtf8(_bytes, _status))
-        return 0;
-
-    // shift + mask the leading sequence bits and sum up the unicode values
-    codePoint += (**_bytes << 6) & 0xfff;
-
-    if (!nextUtf8(_bytes, _status))
-        return 0;
-
-    // mask the leading sequence bits and sum up the unicode values
-    codePoint += **_bytes & 0x3f;
-
-    return codePoint;
-}
-
-int StringEncoder::getSequenceLength(byte_t _byte)
-{
-    if (_byte < 0x80)
-        return 1;
-    else if ((_byte >> 5) == 0x6)    // lead = 0000 01100 = 6 -> 2 bytes sequence
-        return 2;
-    else if ((_byte >> 4) == 0xe)    // lead = 0000 11100 = 14 -> 3 bytes sequence
-        return 3;
-    else if ((_byte >> 3) == 0x1e)   // lead = 0001 11100 = 30 -> 4 bytes sequence
-        return 4;
-    else
-        return 0;
-}
-
-uint32_t StringEncoder::getNextBytes(byte_t **_bytes, EncodingStatus &_status)
-{
-    uint32_t codePoint = 0;
-    int sequenceLength = getSequenceLength(**_bytes);
-
-    switch (sequenceLength)
-    {
-        case 0:
-            _status = EncodingStatus::INVALID_LEAD;
-            break;
-        case 1:
-            codePoint = getByteSequence1(**_bytes, _status);
-            break;
-        case 2:
-            codePoint = getByteSequence2(_bytes, _status);
-            break;
-        case 3:
-            codePoint = getByteSequence3(_bytes, _status);
-            break;
-        case 4:
-            codePoint = getByteSequence4(_bytes, _status);
-            break;
-    }
-
-    if (_status == EncodingStatus::SUCCESS)
+    // the following bytes have the format 10xx xxxx
+    for (size_t i = 1; i < sequenceLength; i++)
     {
-        if (isSequenceTooLong(codePoint, sequenceLength))
-        {
-            _status = EncodingStatus::SEQUENCE_TOO_LONG;
-            return 0;
-        }
-        if (!isCodePointValid(codePoint))
+        if ((_bytes[i] >> 6) != 0x2)
         {
-            _status = EncodingStatus::INVALID_CODE_POINT;
+            _status = EncodingStatus::INCOMPLETE_SEQUENCE;
             return 0;
         }
-    } else
-    {
-        return 0;
+        codePoint = (codePoint << 6) | (_bytes[i] & 0x3f);
     }
 
-    return codePoint;
-}
-
-bytes_t StringEncoder::push(uint32_t _codePoint, EncodingStatus &_status)
-{
-    bytes_t result;
-    if (!isCodePointValid(_codePoint))
+    if (codePoint < minCodePoint)
     {
-        _status = EncodingStatus::INVALID_CODE_POINT;
-        result.push_back(0);
-        return result;
+        _status = EncodingStatus::SEQUENCE_TOO_LONG;
+        return 0;
     }
-
-    if (_codePoint < 0x80)
-    {
-        result.push_back(static_cast<uint8_t>(_codePoint));
-    } else if (_codePoint < 0x800)
-    {
-        result.push_back(static_cast<uint8_t>((_codePoint >> 6) | 0xc0));               // 0xc0 = 1100 0000 add leading sequence (2 bytes)
-        result.push_back(static_cast<uint8_t>((_codePoint & 0x3f) | 0x80));             // 0x80 = 1000 0000 add leading sequence 10 to the following bytes
-    } else if (_codePoint < 0x10000)
+    if (!isCodePointValid(codePoint))
     {
-        result.push_back(static_cast<uint8_t>((_codePoint >> 12) | 0xe0));              // 0xe0 = 1110 0000 add leading sequence (3 bytes)
-        result.push_back(static_cast<uint8_t>(((_codePoint >> 6) & 0x3f) | 0x80));      // 0x80 = 1000 0000 add leading sequence 10 to the following bytes
-        result.push_back(static_cast<uint8_t>((_codePoint & 0x3f) | 0x80));             // 0x80 = 1000 0000 add leading sequence 10 to the following bytes
-    } else
-    {
-        result.push_back(static_cast<uint8_t>((_codePoint >> 18) | 0xf0));              // 0xf0 = 1111 0000 add leading sequence (4 bytes)
-        result.push_back(static_cast<uint8_t>(((_codePoint >> 12) & 0x3f) | 0x80));     // 0x80 = 1000 0000 add leading sequence 10 to the following bytes
-        result.push_back(static_cast<uint8_t>(((_codePoint >> 6) & 0x3f) | 0x80));      // 0x80 = 1000 0000 add leading sequence 10 to the following bytes
-        result.push_back(static_cast<uint8_t>((_codePoint & 0x3f) | 0x80));             // 0x80 = 1000 0000 add leading sequence 10 to the following bytes
+        _status = EncodingStatus::INVALID_CODE_POINT;
+        return 0;
     }
 
-    return result;
+    _bytes += sequenceLength;
+    return codePoint;
 }
 
 } // namespace SomeIP
@@ -48,6 +48,12 @@ StubAdapter::onInterfaceMessage(const Message &) {
     return true;
 }
 
+void
+StubAdapter::updateCachedValue(event_id_t _event, const Message &_notification) const {
+    (void)_event;
+    (void)_notification;
+}
+
 void
 StubAdapter::registerEvent(event_id_t _event, const std::set<eventgroup_id_t> &_eventGroups,
         bool _isField) {
@@ -27,8 +27,12 @@ void StubManager::registerStubAdapter(std::shared_ptr<StubAdapter> _adapter) {
     service_id_t service = itsAddress.getService();
     instance_id_t instance = itsAddress.getInstance();
 
+    {
+        std::lock_guard<std::mutex> itsLock(registeredStubAdaptersMutex_);
+        registeredStubAdapters_[service][instance] = _adapter;
+        updateStubAdapterTable();
+    }
     connection->registerService(itsAddress);
-    registeredStubAdapters_[service][instance] = _adapter;
 }
 
 void StubManager::unregisterStubAdapter(std::shared_ptr<StubAdapter> _adapter) {
@@ -37,27 +41,53 @@ void StubManager::unregisterStubAdapter(std::shared_ptr<StubAdapter> _adapter) {
     service_id_t service = itsAddress.getService();
     instance_id_t instance = itsAddress.getInstance();
 
-    auto foundService = registeredStubAdapters_.find(service);
-    if(foundService != registeredStubAdapters_.end()) {
-        auto foundInstance = foundService->second.find(instance);
-        if (foundInstance != foundService->second.end()) {
-            foundService->second.erase(instance);
-            connection->unregisterService(itsAddress);
+    bool isRegistered(false);
+    {
+        std::lock_guard<std::mutex> itsLock(registeredStubAdaptersMutex_);
+        auto foundService = registeredStubAdapters_.find(service);
+        if(foundService != registeredStubAdapters_.end()) {
+            auto foundInstance = foundService->second.find(instance);
+            if (foundInstance != foundService->second.end()) {
+                foundService->second.erase(instance);
+                updateStubAdapterTable();
+                isRegistered = true;
+            }
         }
     }
+    if (isRegistered) {
+        connection->unregisterService(itsAddress);
+    }
 }
 
 bool StubManager::handleMessage(const Message &_message) {
-    auto foundService = registeredStubAdapters_.find(_message.getServiceId());
-    if(foundService != registeredStubAdapters_.end()) {
-        auto foundInstance = foundService->second.find(_message.getInstanceId());
-        if (foundInstance != foundService->second.end()) {
-            std::shared_ptr<StubAdapter> foundStubAdapter = foundInstance->second;
-            return foundStubAdapter->onInterfaceMessage(_message);
+    std::shared_ptr<StubAdapter> foundStubAdapter;
+    {
+        // The adapter is copied instead of being used while the table is
+        // read, as a stub may (un)register adapters while handling a message.
+        auto itsTable = stubAdapterTable_.read();
+        const std::shared_ptr<StubAdapter> *itsAdapter
+            = itsTable->find(packKey(_message.getServiceId(), _message.getInstanceId()));
+        if (itsAdapter) {
+            foundStubAdapter = *itsAdapter;
         }
     }
+
+    if (foundStubAdapter) {
+        return foundStubAdapter->onInterfaceMessage(_message);
+    }
     return false;
 }
 
+void StubManager::updateStubAdapterTable() {
+    std::vector<std::pair<uint64_t, std::shared_ptr<StubAdapter>>> itsEntries;
+    for (const auto &s : registeredStubAdapters_) {
+        for (const auto &i : s.second) {
+            itsEntries.push_back(std::make_pair(packKey(s.first, i.first), i.second));
+        }
+    }
+    stubAdapterTable_.update(std::unique_ptr<stub_adapter_table_t>(
+            new stub_adapter_table_t(itsEntries)));
+}
+
 } // namespace SomeIP
 } // namespace CommonAPI
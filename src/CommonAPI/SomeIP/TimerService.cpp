@@ -0,0 +1,191 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <CommonAPI/SomeIP/TimerService.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+const uint64_t TimerService::WHEEL_SIZE;
+const uint64_t TimerService::NO_TICK;
+
+static uint64_t countTrailingZeros(uint64_t _bits) {
+#ifdef __GNUC__
+    return uint64_t(__builtin_ctzll(_bits));
+#else
+    uint64_t itsCount(0);
+    while (!(_bits & 1)) {
+        _bits >>= 1;
+        itsCount++;
+    }
+    return itsCount;
+#endif
+}
+
+std::shared_ptr<TimerService>
+TimerService::get() {
+    static std::shared_ptr<TimerService> theTimerService = std::make_shared<TimerService>();
+    return theTimerService;
+}
+
+TimerService::TimerService()
+    : origin_(clock_t::now()),
+      count_(0),
+      currentTick_(0),
+      wakeUpTick_(NO_TICK),
+      isStopped_(false) {
+    for (auto &itsWord : occupied_) {
+        itsWord = 0;
+    }
+}
+
+TimerService::~TimerService() {
+    {
+        std::lock_guard<std::mutex> itsLock(mutex_);
+        isStopped_ = true;
+    }
+    condition_.notify_one();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void TimerService::start(const std::shared_ptr<Timer> &_timer, const time_point_t &_expiry) {
+    // Round up, a timer must not fire before its expiry
+    std::chrono::milliseconds itsDelay
+        = std::chrono::duration_cast<std::chrono::milliseconds>(_expiry - origin_);
+    if (origin_ + itsDelay < _expiry) {
+        itsDelay += std::chrono::milliseconds(1);
+    }
+    uint64_t itsTick = (itsDelay.count() > 0 ? uint64_t(itsDelay.count()) : 0);
+
+    std::lock_guard<std::mutex> itsLock(mutex_);
+    if (itsTick < currentTick_) {
+        itsTick = currentTick_;
+    }
+    _timer->tick_ = itsTick;
+    wheel_[itsTick % WHEEL_SIZE].push_back(_timer);
+    setOccupied(itsTick % WHEEL_SIZE);
+    count_++;
+
+    if (!thread_.joinable()) {
+        thread_ = std::thread(&TimerService::run, this);
+    } else if (itsTick < wakeUpTick_) {
+        condition_.notify_one();
+    }
+}
+
+uint64_t TimerService::getTick(const time_point_t &_time) const {
+    return uint64_t(std::chrono::duration_cast<std::chrono::milliseconds>(_time - origin_).count());
+}
+
+void TimerService::run() {
+    std::vector<std::shared_ptr<Timer>> itsExpired;
+
+    std::unique_lock<std::mutex> itsLock(mutex_);
+    while (!isStopped_) {
+        const uint64_t itsNow = getTick(clock_t::now());
+        if (currentTick_ <= itsNow) {
+            // After a long sleep, a single turn visits every slot
+            if (itsNow - currentTick_ >= WHEEL_SIZE) {
+                currentTick_ = itsNow - WHEEL_SIZE + 1;
+            }
+            for (; currentTick_ <= itsNow; currentTick_++) {
+                if (isOccupied(currentTick_ % WHEEL_SIZE)) {
+                    expire(itsNow, currentTick_ % WHEEL_SIZE, itsExpired);
+                }
+            }
+        }
+
+        if (!itsExpired.empty()) {
+            itsLock.unlock();
+            for (auto &t : itsExpired) {
+                if (!t->isCancelled()) {
+                    t->callback_();
+                }
+            }
+            itsExpired.clear();
+            itsLock.lock();
+            continue;
+        }
+
+        wakeUpTick_ = findNextTick();
+        if (wakeUpTick_ == NO_TICK) {
+            condition_.wait(itsLock);
+        } else {
+            condition_.wait_until(itsLock, origin_ + std::chrono::milliseconds(wakeUpTick_));
+        }
+    }
+}
+
+void TimerService::expire(uint64_t _now, uint64_t _index,
+        std::vector<std::shared_ptr<Timer>> &_expired) {
+    std::vector<std::shared_ptr<Timer>> &itsSlot = wheel_[_index];
+    size_t i = 0;
+    while (i < itsSlot.size()) {
+        if (itsSlot[i]->isCancelled() || itsSlot[i]->tick_ <= _now) {
+            if (!itsSlot[i]->isCancelled()) {
+                _expired.push_back(std::move(itsSlot[i]));
+            }
+            itsSlot[i] = std::move(itsSlot.back());
+            itsSlot.pop_back();
+            count_--;
+        } else {
+            i++;
+        }
+    }
+    if (itsSlot.empty()) {
+        clearOccupied(_index);
+    }
+}
+
+uint64_t TimerService::findNextTick() {
+    uint64_t itsNextTick(NO_TICK);
+    const uint64_t itsEnd = currentTick_ + WHEEL_SIZE;
+    uint64_t t = currentTick_;
+    while (count_ > 0 && t < itsEnd) {
+        // Skip to the next occupied slot, the wheel size is a multiple of
+        // the bitmap word size.
+        const uint64_t itsIndex = t % WHEEL_SIZE;
+        const uint64_t itsBits = occupied_[itsIndex / 64] >> (itsIndex % 64);
+        if (itsBits == 0) {
+            t += 64 - (itsIndex % 64);
+            continue;
+        }
+        t += countTrailingZeros(itsBits);
+        if (t >= itsEnd) {
+            break;
+        }
+
+        std::vector<std::shared_ptr<Timer>> &itsSlot = wheel_[t % WHEEL_SIZE];
+        size_t i = 0;
+        while (i < itsSlot.size()) {
+            if (itsSlot[i]->isCancelled()) {
+                itsSlot[i] = std::move(itsSlot.back());
+                itsSlot.pop_back();
+                count_--;
+            } else {
+                // Slots are visited in order, the first timer that is due
+                // during the current turn is the next one.
+                if (itsSlot[i]->tick_ == t) {
+                    return t;
+                }
+                if (itsSlot[i]->tick_ < itsNextTick) {
+                    itsNextTick = itsSlot[i]->tick_;
+                }
+                i++;
+            }
+        }
+        if (itsSlot.empty()) {
+            clearOccupied(t % WHEEL_SIZE);
+        }
+        t++;
+    }
+    return itsNextTick;
+}
+
+} // namespace SomeIP
+} // namespace CommonAPI
@@ -5,11 +5,10 @@
 
 #include <CommonAPI/SomeIP/Watch.hpp>
 
-#include <fcntl.h>
-
 #ifdef WIN32
 #include <Winsock2.h>
 #else
+#include <sys/eventfd.h>
 #include <unistd.h>
 #endif
 
@@ -18,7 +17,11 @@
 namespace CommonAPI {
 namespace SomeIP {
 
-Watch::Watch(const std::shared_ptr<Connection>& _connection) : connection_(_connection), pipeValue_(4) {
+#ifdef WIN32
+const int Watch::pipeValue_;
+#endif
+
+Watch::Watch(const std::shared_ptr<Connection>& _connection) : isSignalled_(false), connection_(_connection) {
 #ifdef WIN32
     std::string pipeName = "\\\\.\\pipe\\CommonAPI-SomeIP-";
 
@@ -96,10 +99,12 @@ Watch::Watch(const std::shared_ptr<Connection>& _connection) : connection_(_conn
             printf("ERROR: ConnectNamedPipe failed with (%d)\n", error);
         }
     }
+
+    pollFileDescriptor_.fd = pipeFileDescriptors_[0];
 #else
-    pipe2(pipeFileDescriptors_, O_NONBLOCK);
+    eventFileDescriptor_ = eventfd(0, EFD_NONBLOCK);
+    pollFileDescriptor_.fd = eventFileDescriptor_;
 #endif
-    pollFileDescriptor_.fd = pipeFileDescriptors_[0];
     pollFileDescriptor_.events = POLLRDNORM;
 }
 
@@ -122,6 +127,8 @@ Watch::~Watch() {
     if (!retVal) {
         printf(TEXT("CloseHandle2 failed. GLE=%d\n"), GetLastError());
     }
+#else
+    close(eventFileDescriptor_);
 #endif
 }
 
@@ -158,9 +165,47 @@ void Watch::removeDependentDispatchSource(CommonAPI::DispatchSource* _dispatchSo
 }
 
 void Watch::pushQueue(Watch::msgQueueEntry _msgQueueEntry) {
-    std::unique_lock<std::mutex> itsLock(msgQueueMutex_);
-    msgQueue_.push(_msgQueueEntry);
+    msgQueue_.push(std::move(_msgQueueEntry));
 
+    // The main loop is woken up once, it drains the queue before waiting
+    // again.
+    if (!isSignalled_.exchange(true)) {
+        signal();
+    }
+}
+
+bool Watch::popQueue(std::vector<msgQueueEntry> &_entries, std::size_t _maxEntries) {
+    msgQueueEntry itsEntry;
+    while (_maxEntries > 0 && msgQueue_.pop(itsEntry)) {
+        _entries.push_back(std::move(itsEntry));
+        _maxEntries--;
+    }
+
+    if (!msgQueue_.empty()) {
+        return true;
+    }
+
+    if (isSignalled_.load()) {
+        clearSignal();
+        isSignalled_.store(false);
+
+        // A producer that found the signal set before it was reset did not
+        // signal again, so its entry must be taken care of here.
+        if (!msgQueue_.empty()) {
+            if (!isSignalled_.exchange(true)) {
+                signal();
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Watch::emptyQueue() {
+    return msgQueue_.empty();
+}
+
+void Watch::signal() {
 #ifdef WIN32
     char writeValue[sizeof(pipeValue_)];
     *reinterpret_cast<int*>(writeValue) = pipeValue_;
@@ -178,13 +223,11 @@ void Watch::pushQueue(Watch::msgQueueEntry _msgQueueEntry) {
         printf(TEXT("WriteFile to pipe failed. GLE=%d\n"), GetLastError());
     }
 #else
-    write(pipeFileDescriptors_[1], &pipeValue_, sizeof(pipeValue_));
+    eventfd_write(eventFileDescriptor_, 1);
 #endif
 }
 
-void Watch::popQueue() {
-    std::unique_lock<std::mutex> itsLock(msgQueueMutex_);
-
+void Watch::clearSignal() {
 #ifdef WIN32
     char readValue[sizeof(pipeValue_)];
     DWORD cbRead;
@@ -201,23 +244,9 @@ void Watch::popQueue() {
         printf(TEXT("ReadFile to pipe failed. GLE=%d\n"), GetLastError());
     }
 #else
-    int readValue = 0;
-    read(pipeFileDescriptors_[0], &readValue, sizeof(readValue));
+    eventfd_t itsValue;
+    eventfd_read(eventFileDescriptor_, &itsValue);
 #endif
-
-    msgQueue_.pop();
-}
-
-Watch::msgQueueEntry& Watch::frontQueue() {
-    std::unique_lock<std::mutex> itsLock(msgQueueMutex_);
-
-    return msgQueue_.front();
-}
-
-bool Watch::emptyQueue() {
-    std::unique_lock<std::mutex> itsLock(msgQueueMutex_);
-
-    return msgQueue_.empty();
 }
 
 void Watch::processMsgQueueEntry(msgQueueEntry &_msgQueueEntry) {
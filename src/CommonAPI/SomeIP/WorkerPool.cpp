@@ -0,0 +1,79 @@
+// Copyright (C) 2015 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <CommonAPI/SomeIP/WorkerPool.hpp>
+
+namespace CommonAPI {
+namespace SomeIP {
+
+WorkerPool::WorkerPool(std::size_t _threads) {
+    if (_threads == 0) {
+        _threads = 1;
+    }
+    for (std::size_t i = 0; i < _threads; i++) {
+        workers_.push_back(std::unique_ptr<Worker>(new Worker()));
+    }
+    for (auto &w : workers_) {
+        w->thread_ = std::thread(&WorkerPool::run, this, std::ref(*w));
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    for (auto &w : workers_) {
+        {
+            std::lock_guard<std::mutex> itsLock(w->mutex_);
+            w->isStopped_ = true;
+        }
+        w->condition_.notify_one();
+    }
+    for (auto &w : workers_) {
+        if (w->thread_.joinable()) {
+            w->thread_.join();
+        }
+    }
+}
+
+void WorkerPool::post(uint64_t _key, std::function<void()> _task) {
+    // Mix the key first, packed keys differ in their higher bits only
+    _key ^= (_key >> 33);
+    _key *= 0xFF51AFD7ED558CCDULL;
+    _key ^= (_key >> 33);
+    _key *= 0xC4CEB9FE1A85EC53ULL;
+    _key ^= (_key >> 33);
+
+    Worker &itsWorker = *workers_[_key % workers_.size()];
+    bool wasEmpty;
+    {
+        std::lock_guard<std::mutex> itsLock(itsWorker.mutex_);
+        wasEmpty = itsWorker.tasks_.empty();
+        itsWorker.tasks_.push_back(std::move(_task));
+    }
+    if (wasEmpty) {
+        itsWorker.condition_.notify_one();
+    }
+}
+
+void WorkerPool::run(Worker &_worker) {
+    std::unique_lock<std::mutex> itsLock(_worker.mutex_);
+    while (true) {
+        while (!_worker.isStopped_ && _worker.tasks_.empty()) {
+            _worker.condition_.wait(itsLock);
+        }
+        // Pending tasks are dropped on shutdown
+        if (_worker.isStopped_) {
+            break;
+        }
+
+        std::function<void()> itsTask(std::move(_worker.tasks_.front()));
+        _worker.tasks_.pop_front();
+
+        itsLock.unlock();
+        itsTask();
+        itsLock.lock();
+    }
+}
+
+} // namespace SomeIP
+} // namespace CommonAPI